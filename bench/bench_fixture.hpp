@@ -0,0 +1,156 @@
+/**
+ * @file bench_fixture.hpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef BENCH_BENCH_FIXTURE_HPP_
+#define BENCH_BENCH_FIXTURE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fordyca/params/arena_map_params.hpp"
+#include "fordyca/params/depth0/occupancy_grid_params.hpp"
+#include "rcppsw/math/dcoord.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, bench);
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/*
+ * Everything is sized the same as in the experiment input files, so that the
+ * number of cells per arena/LOS is representative.
+ */
+constexpr double kGRID_RESOLUTION = 0.2;
+constexpr double kBLOCK_DIM = 0.2;
+constexpr double kCACHE_DIM = 0.8;
+constexpr double kPHEROMONE_RHO = 0.00001;
+constexpr size_t kLOS_RADIUS = 2;
+constexpr uint kCACHE_PENALTY = 50;
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/*
+ * All benchmarks take the same arguments: arena side length (in meters), #
+ * blocks, # robots.
+ */
+static inline size_t arena_dim(const benchmark::State& state) {
+  return static_cast<size_t>(state.range(0));
+}
+static inline uint n_blocks(const benchmark::State& state) {
+  return static_cast<uint>(state.range(1));
+}
+static inline size_t n_robots(const benchmark::State& state) {
+  return static_cast<size_t>(state.range(2));
+}
+
+/**
+ * @brief The argument sets every benchmark is run with: small/medium/large
+ * arenas, each with a sparse/dense block distribution and a small/large swarm.
+ */
+static inline void bench_args(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"arena", "blocks", "robots"});
+  for (int dim : {16, 32, 64}) {
+    for (int blocks : {dim, dim * 4}) {
+      for (int robots : {16, 128}) {
+        b->Args({dim, blocks, robots});
+      } /* for(robots..) */
+    }   /* for(blocks..) */
+  }     /* for(dim..) */
+}
+
+/**
+ * @brief Arena parameters for a square arena, with the nest along the west
+ * wall, in the same relative position as in the experiment input files.
+ */
+static inline params::arena_map_params arena_params(
+    const benchmark::State& state,
+    const std::string& dist_model) {
+  params::arena_map_params params;
+  double dim = arena_dim(state);
+
+  params.grid.resolution = kGRID_RESOLUTION;
+  params.grid.lower.Set(0.0, 0.0);
+  params.grid.upper.Set(dim, dim);
+
+  params.block.n_blocks = n_blocks(state);
+  params.block.dimension = kBLOCK_DIM;
+  params.block.dist_model = dist_model;
+
+  params.cache.create_static = true;
+  params.cache.static_size = n_blocks(state);
+  params.cache.dimension = kCACHE_DIM;
+  params.cache.min_dist = kCACHE_DIM * 2;
+  params.cache.usage_penalty = kCACHE_PENALTY;
+
+  params.nest_center.Set(1.5, dim / 2.0);
+  params.nest_x.Set(1.0, 2.0);
+  params.nest_y.Set(dim / 2.0 - 0.5, dim / 2.0 + 0.5);
+  return params;
+}
+
+/**
+ * @brief Occupancy grid parameters covering the same arena as \ref
+ * arena_params().
+ */
+static inline params::depth0::occupancy_grid_params grid_params(
+    const benchmark::State& state,
+    bool lazy_decay) {
+  params::depth0::occupancy_grid_params params;
+  double dim = arena_dim(state);
+
+  params.grid.resolution = kGRID_RESOLUTION;
+  params.grid.lower.Set(0.0, 0.0);
+  params.grid.upper.Set(dim, dim);
+  params.pheromone.rho = kPHEROMONE_RHO;
+  params.pheromone.repeat_deposit = false;
+  params.pheromone.lazy_decay = lazy_decay;
+  return params;
+}
+
+/**
+ * @brief Robot locations (in cells), uniformly distributed over the arena
+ * away from the walls. Uses a fixed seed, so that all runs see the same
+ * locations.
+ */
+static inline std::vector<rcppsw::math::dcoord2> robot_locs(
+    const benchmark::State& state) {
+  size_t cells = static_cast<size_t>(arena_dim(state) / kGRID_RESOLUTION);
+  std::mt19937 rng(n_robots(state));
+  std::uniform_int_distribution<size_t> dist(kLOS_RADIUS,
+                                             cells - kLOS_RADIUS - 1);
+  std::vector<rcppsw::math::dcoord2> locs;
+  for (size_t i = 0; i < n_robots(state); ++i) {
+    locs.emplace_back(dist(rng), dist(rng));
+  } /* for(i..) */
+  return locs;
+}
+
+NS_END(bench, fordyca);
+
+#endif /* BENCH_BENCH_FIXTURE_HPP_ */
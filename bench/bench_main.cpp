@@ -0,0 +1,48 @@
+/**
+ * @file bench_main.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <argos3/core/utility/math/rng.h>
+#include <benchmark/benchmark.h>
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/*
+ * Block distribution uses the ARGoS RNG, which is normally seeded by the
+ * simulator from the input file.
+ */
+constexpr uint kRNG_SEED = 123;
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+int main(int argc, char** argv) {
+  argos::CRandom::CreateCategory("argos", kRNG_SEED);
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
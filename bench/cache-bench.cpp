@@ -0,0 +1,223 @@
+/**
+ * @file cache-bench.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <memory>
+#include <set>
+
+#include "bench/bench_fixture.hpp"
+#include "fordyca/controller/base_foraging_sensors.hpp"
+#include "fordyca/controller/depth1/foraging_controller.hpp"
+#include "fordyca/events/free_block_drop.hpp"
+#include "fordyca/representation/arena_grid.hpp"
+#include "fordyca/representation/arena_map.hpp"
+#include "fordyca/representation/block.hpp"
+#include "fordyca/support/depth1/cache_penalty_handler.hpp"
+#include "fordyca/support/depth2/dynamic_cache_creator.hpp"
+#include "rcppsw/er/server.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca;
+using namespace fordyca::bench;
+using representation::arena_map;
+using representation::arena_grid;
+using block_vector = std::vector<std::shared_ptr<representation::block>>;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief A depth1 controller that is always trying to pick up from the cache
+ * it is sitting on, without any of the ARGoS sensors/actuators or task
+ * executive that a real one needs. \ref cache_penalty_handler is templated on
+ * the controller type, so the functions below hide the real ones.
+ */
+class bench_controller : public controller::depth1::foraging_controller {
+ public:
+  explicit bench_controller(const argos::CVector2& loc) {
+    base_sensors(std::make_shared<controller::base_foraging_sensors>(
+        0.0,
+        argos::CRange<argos::CRadians>(argos::CRadians(), argos::CRadians()),
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr));
+    robot_loc(loc);
+  }
+
+  bool cache_acquired(void) const { return true; }
+  bool block_detected(void) const { return false; }
+};
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/*
+ * Dynamic cache creation is run over a fixed size arena, with increasing
+ * numbers of blocks that are either scattered uniformly over the arena, or
+ * dropped in tight clusters of kCLUSTER_SIZE blocks (as robots leave them when
+ * they abandon blocks near each other).
+ */
+constexpr int kDYNAMIC_ARENA_DIM = 32;
+constexpr size_t kCLUSTER_SIZE = 8;
+constexpr size_t kCLUSTER_RADIUS = 2;
+
+static inline bool clustered(const benchmark::State& state) {
+  return 0 != state.range(2);
+}
+
+static void dynamic_cache_args(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"arena", "blocks", "clustered"});
+  for (int blocks : {64, 256, 1024}) {
+    for (int layout : {0, 1}) {
+      b->Args({kDYNAMIC_ARENA_DIM, blocks, layout});
+    } /* for(layout..) */
+  }   /* for(blocks..) */
+}
+
+/**
+ * @brief Drop blocks onto distinct cells of the grid, either uniformly, or in
+ * clusters around uniformly chosen centers. Uses a fixed seed, so that all
+ * runs see the same layout.
+ */
+static block_vector blocks_drop(const benchmark::State& state,
+                                arena_grid& grid) {
+  std::mt19937 rng(n_blocks(state));
+  std::uniform_int_distribution<size_t> xdist(kCLUSTER_RADIUS,
+                                              grid.xdsize() -
+                                                  kCLUSTER_RADIUS - 1);
+  std::uniform_int_distribution<size_t> ydist(kCLUSTER_RADIUS,
+                                              grid.ydsize() -
+                                                  kCLUSTER_RADIUS - 1);
+  std::uniform_int_distribution<int> offset(
+      -static_cast<int>(kCLUSTER_RADIUS), static_cast<int>(kCLUSTER_RADIUS));
+
+  std::set<rcppsw::math::dcoord2> used;
+  block_vector blocks;
+  rcppsw::math::dcoord2 center(xdist(rng), ydist(rng));
+  size_t misses = 0;
+  while (blocks.size() < n_blocks(state)) {
+    rcppsw::math::dcoord2 loc(xdist(rng), ydist(rng));
+    if (clustered(state)) {
+      /* start a new cluster, or move the current one if its area is full */
+      if (0 == blocks.size() % kCLUSTER_SIZE || misses > kCLUSTER_SIZE) {
+        center = loc;
+        misses = 0;
+      }
+      loc = {center.first + offset(rng), center.second + offset(rng)};
+    }
+    if (!used.insert(loc).second) {
+      ++misses;
+      continue;
+    }
+    misses = 0;
+    auto block = std::make_shared<representation::block>(
+        kBLOCK_DIM, static_cast<int>(blocks.size()));
+    events::free_block_drop op(
+        rcppsw::er::g_server, block, loc.first, loc.second, grid.resolution());
+    grid.access(op.x(), op.y()).accept(op);
+    blocks.push_back(block);
+  } /* while() */
+  return blocks;
+}
+
+/*******************************************************************************
+ * Benchmarks
+ ******************************************************************************/
+/*
+ * (Re-)creating the static cache out of all of the blocks in the arena, as
+ * happens whenever it is depleted.
+ */
+static void BM_static_cache_create(benchmark::State& state) {
+  auto params = arena_params(state, "single_source");
+  for (auto _ : state) {
+    state.PauseTiming();
+    arena_map map(&params);
+    map.distribute_blocks();
+    state.ResumeTiming();
+    map.static_cache_create();
+    benchmark::DoNotOptimize(map.n_caches());
+  } /* for(_..) */
+  state.SetItemsProcessed(state.iterations() * n_blocks(state));
+}
+BENCHMARK(BM_static_cache_create)->Apply(bench_args);
+
+/*
+ * Creating caches out of all free blocks in the arena with the dynamic cache
+ * creator. Clustering dominates for scattered blocks (few caches are created),
+ * and cache creation for clustered ones.
+ */
+static void BM_dynamic_cache_create(benchmark::State& state) {
+  size_t n_caches = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    arena_grid grid(kGRID_RESOLUTION, arena_dim(state), arena_dim(state));
+    block_vector blocks = blocks_drop(state, grid);
+    support::depth2::dynamic_cache_creator creator(rcppsw::er::g_server,
+                                                   grid,
+                                                   kCACHE_DIM,
+                                                   kGRID_RESOLUTION,
+                                                   kCACHE_DIM * 2);
+    state.ResumeTiming();
+    auto caches = creator.create_all(blocks);
+    n_caches = caches.size();
+    benchmark::DoNotOptimize(caches.data());
+  } /* for(_..) */
+  state.counters["caches"] = n_caches;
+  state.SetItemsProcessed(state.iterations() * n_blocks(state));
+}
+BENCHMARK(BM_dynamic_cache_create)->Apply(dynamic_cache_args);
+
+/*
+ * Every robot arriving at the static cache on the same timestep, waiting out
+ * its penalty, and then leaving (the worst case for penalty slot allocation).
+ */
+static void BM_cache_penalty_handler(benchmark::State& state) {
+  auto params = arena_params(state, "single_source");
+  arena_map map(&params);
+  map.distribute_blocks();
+  map.static_cache_create();
+
+  std::vector<std::unique_ptr<bench_controller>> robots;
+  for (size_t i = 0; i < n_robots(state); ++i) {
+    robots.push_back(rcppsw::make_unique<bench_controller>(
+        map.caches().front()->real_loc()));
+  } /* for(i..) */
+
+  support::depth1::cache_penalty_handler handler(
+      rcppsw::er::g_server, map, kCACHE_PENALTY);
+  uint timestep = 0;
+  for (auto _ : state) {
+    for (auto& r : robots) {
+      handler.penalty_init(*r, timestep);
+    } /* for(&r..) */
+    timestep += kCACHE_PENALTY + static_cast<uint>(n_robots(state));
+    for (auto& r : robots) {
+      benchmark::DoNotOptimize(handler.penalty_satisfied(*r, timestep));
+      handler.remove(*r);
+    } /* for(&r..) */
+  }   /* for(_..) */
+  state.SetItemsProcessed(state.iterations() * n_robots(state));
+}
+BENCHMARK(BM_cache_penalty_handler)->Apply(bench_args);
@@ -0,0 +1,162 @@
+/**
+ * @file representation-bench.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <memory>
+
+#include "bench/bench_fixture.hpp"
+#include "fordyca/events/block_found.hpp"
+#include "fordyca/representation/arena_map.hpp"
+#include "fordyca/representation/block.hpp"
+#include "fordyca/representation/line_of_sight.hpp"
+#include "fordyca/representation/perceived_arena_map.hpp"
+#include "rcppsw/er/server.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca;
+using namespace fordyca::bench;
+using representation::arena_map;
+using representation::perceived_arena_map;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+/**
+ * @brief A perceived arena map for each robot, which has seen every block in
+ * the arena.
+ */
+static std::vector<std::unique_ptr<perceived_arena_map>> perceived_maps_init(
+    const benchmark::State& state,
+    arena_map& map,
+    bool lazy_decay) {
+  auto params = grid_params(state, lazy_decay);
+  std::vector<std::unique_ptr<perceived_arena_map>> maps;
+  for (size_t i = 0; i < n_robots(state); ++i) {
+    maps.push_back(rcppsw::make_unique<perceived_arena_map>(
+        rcppsw::er::g_server, &params, "fb" + std::to_string(i)));
+    for (auto& b : map.blocks()) {
+      events::block_found op(rcppsw::er::g_server, b->clone());
+      maps.back()->accept(op);
+    } /* for(&b..) */
+  }   /* for(i..) */
+  return maps;
+}
+
+/*******************************************************************************
+ * Benchmarks
+ ******************************************************************************/
+static void BM_arena_map_construct(benchmark::State& state) {
+  auto params = arena_params(state, "random");
+  for (auto _ : state) {
+    arena_map map(&params);
+    benchmark::DoNotOptimize(map.n_blocks());
+  } /* for(_..) */
+}
+BENCHMARK(BM_arena_map_construct)->Apply(bench_args);
+
+static void BM_arena_map_distribute_blocks(benchmark::State& state) {
+  auto params = arena_params(state, "random");
+  arena_map map(&params);
+  for (auto _ : state) {
+    map.distribute_blocks();
+  } /* for(_..) */
+  state.SetItemsProcessed(state.iterations() * n_blocks(state));
+}
+BENCHMARK(BM_arena_map_distribute_blocks)->Apply(bench_args);
+
+/*
+ * One update of every robot's occupancy grid (i.e. one timestep for the
+ * swarm).
+ */
+static void BM_occupancy_grid_update(benchmark::State& state,
+                                     bool lazy_decay) {
+  auto params = arena_params(state, "random");
+  arena_map map(&params);
+  map.distribute_blocks();
+  auto maps = perceived_maps_init(state, map, lazy_decay);
+
+  uint timestep = 0;
+  for (auto _ : state) {
+    ++timestep;
+    for (auto& m : maps) {
+      m->update(timestep);
+    } /* for(&m..) */
+  }   /* for(_..) */
+  state.SetItemsProcessed(state.iterations() * n_robots(state));
+}
+BENCHMARK_CAPTURE(BM_occupancy_grid_update, eager, false)->Apply(bench_args);
+BENCHMARK_CAPTURE(BM_occupancy_grid_update, lazy, true)->Apply(bench_args);
+
+static void BM_perceived_arena_map_block_add_remove(benchmark::State& state) {
+  auto params = arena_params(state, "random");
+  arena_map map(&params);
+  map.distribute_blocks();
+
+  auto gparams = grid_params(state, false);
+  perceived_arena_map pmap(rcppsw::er::g_server, &gparams, "fb0");
+  std::vector<std::shared_ptr<representation::block>> blocks;
+  for (auto& b : map.blocks()) {
+    blocks.push_back(b->clone());
+  } /* for(&b..) */
+
+  for (auto _ : state) {
+    for (auto& b : blocks) {
+      pmap.block_add(b);
+    } /* for(&b..) */
+    for (auto& b : blocks) {
+      pmap.block_remove(b);
+    } /* for(&b..) */
+  }   /* for(_..) */
+  state.SetItemsProcessed(state.iterations() * n_blocks(state) * 2);
+}
+BENCHMARK(BM_perceived_arena_map_block_add_remove)->Apply(bench_args);
+
+/*
+ * Re-targeting each robot's LOS and getting the blocks in it (i.e. what the
+ * loop functions and controllers do for every robot each timestep).
+ */
+static void BM_line_of_sight_blocks(benchmark::State& state) {
+  auto params = arena_params(state, "random");
+  arena_map map(&params);
+  map.distribute_blocks();
+  auto locs = robot_locs(state);
+
+  std::vector<std::unique_ptr<representation::line_of_sight>> los(
+      n_robots(state));
+  for (auto& l : los) {
+    l = rcppsw::make_unique<representation::line_of_sight>();
+  } /* for(&l..) */
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < los.size(); ++i) {
+      map.subgrid_allocate(locs[i].first, locs[i].second, kLOS_RADIUS);
+    } /* for(i..) */
+    for (size_t i = 0; i < los.size(); ++i) {
+      los[i]->retarget(map.grid(), locs[i], kLOS_RADIUS);
+      benchmark::DoNotOptimize(los[i]->blocks().size());
+    } /* for(i..) */
+  }   /* for(_..) */
+  state.SetItemsProcessed(state.iterations() * n_robots(state));
+}
+BENCHMARK(BM_line_of_sight_blocks)->Apply(bench_args);
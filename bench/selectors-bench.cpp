@@ -0,0 +1,129 @@
+/**
+ * @file selectors-bench.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <list>
+
+#include "bench/bench_fixture.hpp"
+#include "fordyca/controller/depth0/block_selector.hpp"
+#include "fordyca/controller/depth1/existing_cache_selector.hpp"
+#include "fordyca/events/block_found.hpp"
+#include "fordyca/representation/arena_cache.hpp"
+#include "fordyca/representation/arena_map.hpp"
+#include "fordyca/representation/block.hpp"
+#include "fordyca/representation/perceived_arena_map.hpp"
+#include "rcppsw/er/server.hpp"
+#include "rcppsw/swarm/pheromone_density.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca;
+using namespace fordyca::bench;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+static std::vector<argos::CVector2> robot_rlocs(const benchmark::State& state) {
+  std::vector<argos::CVector2> rlocs;
+  for (auto& d : robot_locs(state)) {
+    rlocs.emplace_back(d.first * kGRID_RESOLUTION,
+                       d.second * kGRID_RESOLUTION);
+  } /* for(&d..) */
+  return rlocs;
+}
+
+/*******************************************************************************
+ * Benchmarks
+ ******************************************************************************/
+/*
+ * Every robot selecting the best block, when it knows about every block in the
+ * arena (the worst case).
+ */
+static void BM_block_selector_calc_best(benchmark::State& state) {
+  auto params = arena_params(state, "random");
+  representation::arena_map map(&params);
+  map.distribute_blocks();
+
+  auto gparams = grid_params(state, false);
+  representation::perceived_arena_map pmap(
+      rcppsw::er::g_server, &gparams, "fb0");
+  for (auto& b : map.blocks()) {
+    events::block_found op(rcppsw::er::g_server, b->clone());
+    pmap.accept(op);
+  } /* for(&b..) */
+  auto blocks = pmap.perceived_blocks();
+  auto rlocs = robot_rlocs(state);
+
+  controller::depth0::block_selector selector(rcppsw::er::g_server,
+                                              params.nest_center);
+  for (auto _ : state) {
+    for (auto& loc : rlocs) {
+      benchmark::DoNotOptimize(selector.calc_best(blocks, loc));
+    } /* for(&loc..) */
+  }   /* for(_..) */
+  state.SetItemsProcessed(state.iterations() * n_robots(state));
+}
+BENCHMARK(BM_block_selector_calc_best)->Apply(bench_args);
+
+/*
+ * Every robot selecting the best existing cache, when it knows about every
+ * cache in the arena. There is one (minimum size) cache for every 8 blocks.
+ */
+static void BM_existing_cache_selector_calc_best(benchmark::State& state) {
+  auto params = arena_params(state, "random");
+  size_t n_caches = std::max(1U, n_blocks(state) / 8);
+  size_t cells = static_cast<size_t>(arena_dim(state) / kGRID_RESOLUTION);
+  std::mt19937 rng(n_caches);
+  std::uniform_int_distribution<size_t> dist(0, cells - 1);
+
+  std::list<representation::perceived_cache> caches;
+  for (size_t i = 0; i < n_caches; ++i) {
+    std::vector<std::shared_ptr<representation::block>> blocks;
+    for (size_t j = 0; j < representation::base_cache::kMinBlocks; ++j) {
+      blocks.push_back(std::make_shared<representation::block>(
+          kBLOCK_DIM, static_cast<int>(i * 2 + j)));
+    } /* for(j..) */
+    argos::CVector2 center(dist(rng) * kGRID_RESOLUTION,
+                           dist(rng) * kGRID_RESOLUTION);
+    rcppsw::swarm::pheromone_density density;
+    density.rho(kPHEROMONE_RHO);
+    density.pheromone_add(1.0);
+    density.calc();
+    caches.emplace_back(
+        std::make_shared<representation::arena_cache>(
+            kCACHE_DIM, kGRID_RESOLUTION, center, blocks, static_cast<int>(i)),
+        density);
+  } /* for(i..) */
+  auto rlocs = robot_rlocs(state);
+
+  controller::depth1::existing_cache_selector selector(rcppsw::er::g_server,
+                                                       params.nest_center);
+  for (auto _ : state) {
+    for (auto& loc : rlocs) {
+      benchmark::DoNotOptimize(selector.calc_best(caches, loc));
+    } /* for(&loc..) */
+  }   /* for(_..) */
+  state.SetItemsProcessed(state.iterations() * n_robots(state));
+}
+BENCHMARK(BM_existing_cache_selector_calc_best)->Apply(bench_args);
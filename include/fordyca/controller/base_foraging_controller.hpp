@@ -26,7 +26,7 @@
  ******************************************************************************/
 #include <argos3/core/control_interface/ci_controller.h>
 #include <argos3/core/utility/math/vector2.h>
-#include "rcppsw/er/client.hpp"
+#include "fordyca/er/er_profile.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -85,6 +85,12 @@ class base_foraging_controller : public argos::CCI_Controller,
    */
   bool display_id(void) const { return m_display_id; }
 
+  /**
+   * @brief Get the ID of the robot as an integer, parsed once from its ID
+   * string during initialization.
+   */
+  int entity_id(void) const { return m_entity_id; }
+
   /**
    * @brief If \c TRUE, the robot is currently at least most of the way in the
    * nest, as reported by the sensors.
@@ -181,6 +187,7 @@ class base_foraging_controller : public argos::CCI_Controller,
 
   // clang-format off
   bool                                   m_display_id{false};
+  int                                    m_entity_id{-1};
   double                                 m_speed_throttle_block_carry{0.0};
   std::shared_ptr<representation::block> m_block{nullptr};
   std::shared_ptr<actuator_manager>      m_actuators;
@@ -59,24 +59,34 @@ class foraging_sensors : public base_foraging_sensors {
    *
    * Not used by \ref stateless_foraging_controller.
    */
-  const representation::line_of_sight* los(void) const { return m_los.get(); }
+  const representation::line_of_sight* los(void) const {
+    return m_los.targeted() ? &m_los : nullptr;
+  }
 
   /**
-   * @brief Set the robots LOS for the next timestep.
+   * @brief Re-target the robot's LOS for the next timestep.
    *
    * This is a hack to make it easy for me to run simulations, as I can computer
    * the line of sight for a robot within the loop functions, and just pass it
    * in here. In real robots this routine would be MUCH messier and harder to
    * work with.
    *
-   * @param los The new los
+   * @param grid The arena grid.
+   * @param center The (discrete) center of the LOS.
+   * @param radius The radius of the LOS (in cells).
+   *
+   * @return The re-targeted LOS.
    */
-  void los(std::unique_ptr<representation::line_of_sight>& los) {
-    m_los = std::move(los);
+  representation::line_of_sight& los_retarget(
+      const representation::arena_grid& grid,
+      const rcppsw::math::dcoord2& center,
+      size_t radius) {
+    m_los.retarget(grid, center, radius);
+    return m_los;
   }
 
  private:
-  std::unique_ptr<representation::line_of_sight> m_los;
+  representation::line_of_sight m_los;
 };
 
 NS_END(depth0, controller, fordyca);
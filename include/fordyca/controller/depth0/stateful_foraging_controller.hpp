@@ -28,6 +28,7 @@
 
 #include "rcppsw/patterns/visitor/visitable.hpp"
 #include "fordyca/controller/depth0/stateless_foraging_controller.hpp"
+#include "fordyca/representation/arena_grid.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -39,7 +40,9 @@ class executable_task;
 
 NS_START(fordyca);
 namespace tasks { class generalist; class foraging_task; };
-namespace representation { class perceived_arena_map; }
+namespace representation {
+class perceived_arena_map; class line_of_sight; class cell2D;
+}
 
 NS_START(controller);
 namespace visitor = rcppsw::patterns::visitor;
@@ -81,14 +84,23 @@ class stateful_foraging_controller : public stateless_foraging_controller,
   tasks::foraging_task* current_task(void) const;
 
   /**
-   * @brief Set the robot's current line of sight (LOS).
+   * @brief Re-target the robot's line of sight (LOS) to a new region of the
+   * arena. The LOS object itself persists across timesteps.
+   *
+   * @return The re-targeted LOS.
    */
-  void los(std::unique_ptr<representation::line_of_sight>& new_los);
+  representation::line_of_sight& los_retarget(
+      const representation::arena_grid& grid,
+      const rcppsw::math::dcoord2& center,
+      size_t radius);
 
   /**
    * @brief Process the LOS for a given timestep.
    *
-   * Only handles blocks within a LOS; caches are ignored.
+   * Only handles blocks within a LOS; caches are ignored. Only the cells that
+   * entered the LOS or changed since the last timestep are fully processed;
+   * blocks that are still visible and unchanged just have their relevance
+   * refreshed.
    */
   virtual void process_los(const representation::line_of_sight* los);
 
@@ -119,6 +131,20 @@ class stateful_foraging_controller : public stateless_foraging_controller,
   bool is_transporting_to_nest(void) const override;
 
  private:
+  /**
+   * @brief Synchronize the robot's map with a LOS cell that is new or has
+   * changed since the last timestep: remove any block the robot thinks is
+   * there but is not, and (re-)discover the block that is there, if any.
+   */
+  void los_block_sync(const representation::cell2D& los_cell);
+
+  /**
+   * @brief Handle a LOS cell whose block has not changed since the last
+   * timestep. If the robot's map still agrees with the cell, the block's
+   * relevance is refreshed; otherwise the cell is synchronized.
+   */
+  void los_block_refresh(const representation::cell2D& los_cell);
+
   // clang-format off
   bool                                                 m_display_los{false};
   argos::CVector2                                      m_light_loc;
@@ -27,7 +27,7 @@
 #include <list>
 #include <argos3/core/utility/math/vector2.h>
 
-#include "rcppsw/er/client.hpp"
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/representation/perceived_cache.hpp"
 
 /*******************************************************************************
@@ -49,6 +49,7 @@ class collector;
 class generalist;
 class foraging_task;
 }
+namespace representation { class base_cache; }
 
 NS_START(controller, depth1);
 
@@ -97,7 +98,11 @@ class foraging_controller : public depth0::stateful_foraging_controller,
   bool block_acquired(void) const;
 
   /**
-   * @brief Process the LOS for the current timestep (blocks and caches)
+   * @brief Process the LOS for the current timestep (blocks and caches).
+   *
+   * As with blocks, only caches in cells that entered the LOS or changed since
+   * the last timestep are fully processed. Caches that only partially overlap
+   * the LOS are always fully processed.
    */
   void process_los(const representation::line_of_sight* c_los) override;
 
@@ -124,6 +129,24 @@ class foraging_controller : public depth0::stateful_foraging_controller,
   std::string subtask_selection(void) const override;
 
  private:
+  /**
+   * @brief Synchronize the robot's map with a LOS cell that is new or has
+   * changed since the last timestep (caches only).
+   */
+  void los_cache_sync(const representation::cell2D& los_cell);
+
+  /**
+   * @brief Handle a LOS cell whose cache has not changed since the last
+   * timestep, refreshing its relevance if the robot's map agrees with it.
+   */
+  void los_cache_refresh(const representation::cell2D& los_cell);
+
+  /**
+   * @brief (Re-)discover a cache in the LOS.
+   */
+  void cache_discover(
+      const std::shared_ptr<const representation::base_cache>& cache);
+
   void task_abort_cleanup(task_allocation::executable_task*);
   void task_alloc_notify(task_allocation::executable_task*);
   void task_finish_notify(task_allocation::executable_task*);
@@ -28,7 +28,7 @@
 #include <utility>
 #include <argos3/core/utility/math/vector2.h>
 
-#include "rcppsw/er/client.hpp"
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/representation/perceived_cache.hpp"
 
 /*******************************************************************************
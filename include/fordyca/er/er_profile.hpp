@@ -0,0 +1,96 @@
+/**
+ * @file er_profile.hpp
+ * @ingroup er
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_ER_ER_PROFILE_HPP_
+#define INCLUDE_FORDYCA_ER_ER_PROFILE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdio>
+
+#include "rcppsw/er/client.hpp"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/*
+ * Event reporting levels, in order of increasing verbosity. ER_ASSERT() and
+ * ER_FATAL_SENTINEL() are never compiled out.
+ */
+#define FORDYCA_ER_LVL_ERR 1
+#define FORDYCA_ER_LVL_WARN 2
+#define FORDYCA_ER_LVL_NOM 3
+#define FORDYCA_ER_LVL_DIAG 4
+#define FORDYCA_ER_LVL_VER 5
+
+/*
+ * The most verbose level compiled in for the whole build, set from the
+ * FORDYCA_ER_PROFILE build option. Defaults to everything.
+ */
+#ifndef FORDYCA_ER_MAX_LVL
+#define FORDYCA_ER_MAX_LVL FORDYCA_ER_LVL_VER
+#endif
+
+/*
+ * The most verbose level compiled in for a single module (translation unit).
+ * To lower it, define FORDYCA_ER_MODULE_LVL before the first #include in the
+ * .cpp file. It cannot be used to compile in levels the build profile has
+ * compiled out.
+ */
+#if defined(FORDYCA_ER_MODULE_LVL) && \
+    (FORDYCA_ER_MODULE_LVL < FORDYCA_ER_MAX_LVL)
+#define FORDYCA_ER_LVL FORDYCA_ER_MODULE_LVL
+#else
+#define FORDYCA_ER_LVL FORDYCA_ER_MAX_LVL
+#endif
+
+/*
+ * A compiled out report: the arguments are still type checked against the
+ * format string (so that reports do not rot in release builds, and variables
+ * only used in reports are not flagged as unused), but are never evaluated.
+ */
+#define FORDYCA_ER_DISCARD(...)             \
+  do {                                      \
+    (void)sizeof(std::printf(__VA_ARGS__)); \
+  } while (0)
+
+#if FORDYCA_ER_LVL < FORDYCA_ER_LVL_VER
+#undef ER_VER
+#define ER_VER(...) FORDYCA_ER_DISCARD(__VA_ARGS__)
+#endif
+
+#if FORDYCA_ER_LVL < FORDYCA_ER_LVL_DIAG
+#undef ER_DIAG
+#define ER_DIAG(...) FORDYCA_ER_DISCARD(__VA_ARGS__)
+#endif
+
+#if FORDYCA_ER_LVL < FORDYCA_ER_LVL_NOM
+#undef ER_NOM
+#define ER_NOM(...) FORDYCA_ER_DISCARD(__VA_ARGS__)
+#endif
+
+#if FORDYCA_ER_LVL < FORDYCA_ER_LVL_WARN
+#undef ER_WARN
+#define ER_WARN(...) FORDYCA_ER_DISCARD(__VA_ARGS__)
+#endif
+
+#endif /* INCLUDE_FORDYCA_ER_ER_PROFILE_HPP_ */
@@ -24,8 +24,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/events/perceived_cell_op.hpp"
-#include "rcppsw/er/client.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -55,7 +55,6 @@ class block_found : public perceived_cell_op, public rcppsw::er::client {
  public:
   block_found(const std::shared_ptr<rcppsw::er::server>& server,
               std::unique_ptr<representation::block> block);
-  ~block_found(void) override;
 
   block_found(const block_found& op) = delete;
   block_found& operator=(const block_found& op) = delete;
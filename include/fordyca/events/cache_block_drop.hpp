@@ -24,9 +24,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/events/block_drop_event.hpp"
 #include "fordyca/events/cell_op.hpp"
-#include "rcppsw/er/client.hpp"
 #include "rcppsw/patterns/visitor/visitor.hpp"
 
 /*******************************************************************************
@@ -73,7 +73,6 @@ class cache_block_drop
                    const std::shared_ptr<representation::block>& block,
                    const std::shared_ptr<representation::arena_cache>& cache,
                    double resolution);
-  ~cache_block_drop(void) override { client::rmmod(); }
 
   cache_block_drop(const cache_block_drop& op) = delete;
   cache_block_drop& operator=(const cache_block_drop& op) = delete;
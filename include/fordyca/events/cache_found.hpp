@@ -24,8 +24,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/events/perceived_cell_op.hpp"
-#include "rcppsw/er/client.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -53,7 +53,6 @@ class cache_found : public perceived_cell_op, public rcppsw::er::client {
  public:
   cache_found(const std::shared_ptr<rcppsw::er::server>& server,
               std::unique_ptr<representation::base_cache> cache);
-  ~cache_found(void) override;
 
   cache_found(const cache_found& op) = delete;
   cache_found& operator=(const cache_found& op) = delete;
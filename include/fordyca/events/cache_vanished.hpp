@@ -24,9 +24,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/events/block_pickup_event.hpp"
 #include "fordyca/events/cell_op.hpp"
-#include "rcppsw/er/client.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -70,7 +70,6 @@ class cache_vanished
  public:
   cache_vanished(const std::shared_ptr<rcppsw::er::server>& server,
                  uint cache_id);
-  ~cache_vanished(void) override { client::rmmod(); }
 
   cache_vanished(const cache_vanished& op) = delete;
   cache_vanished& operator=(const cache_vanished& op) = delete;
@@ -24,9 +24,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/events/block_pickup_event.hpp"
 #include "fordyca/events/cell_op.hpp"
-#include "rcppsw/er/client.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -64,7 +64,6 @@ class cached_block_pickup
   cached_block_pickup(const std::shared_ptr<rcppsw::er::server>& server,
                       const std::shared_ptr<representation::arena_cache>& cache,
                       size_t robot_index);
-  ~cached_block_pickup(void) override { client::rmmod(); }
 
   cached_block_pickup(const cached_block_pickup& op) = delete;
   cached_block_pickup& operator=(const cached_block_pickup& op) = delete;
@@ -0,0 +1,91 @@
+/**
+ * @file er_module.hpp
+ * @ingroup events
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_EVENTS_ER_MODULE_HPP_
+#define INCLUDE_FORDYCA_EVENTS_ER_MODULE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "fordyca/er/er_profile.hpp"
+#include "rcppsw/er/server.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, events);
+
+/*******************************************************************************
+ * Free Functions
+ ******************************************************************************/
+/**
+ * @brief Get the event reporting module for events of type T that report to
+ * the specified server, registering it the first time it is requested.
+ *
+ * Events are created (and destroyed) many times per timestep, and so rather
+ * than registering/unregistering a module with the server on every
+ * construction, each event type registers exactly one module per server, and
+ * events copy their \ref rcppsw::er::client handle from it.
+ *
+ * Each thread caches the modules it has looked up, so only the first lookup
+ * of a given server from a given thread takes the registration lock; after
+ * that constructing an event is lock free. The cached pointers cannot dangle:
+ * registered modules live until exit, and each holds a reference to its
+ * server, so a server address is never reused for a different server.
+ *
+ * @param server The server events of this type report to.
+ * @param name The name of the module.
+ */
+template <typename T>
+const rcppsw::er::client& er_module(
+    const std::shared_ptr<rcppsw::er::server>& server,
+    const std::string& name) {
+  using module_map = std::unordered_map<const rcppsw::er::server*,
+                                        std::unique_ptr<rcppsw::er::client>>;
+  using module_cache = std::unordered_map<const rcppsw::er::server*,
+                                          const rcppsw::er::client*>;
+  thread_local module_cache cache;
+  auto cached = cache.find(server.get());
+  if (cache.end() != cached) {
+    return *cached->second;
+  }
+
+  static module_map modules;
+  static std::mutex mtx;
+  std::lock_guard<std::mutex> lock(mtx);
+  auto it = modules.find(server.get());
+  if (modules.end() == it) {
+    auto module = rcppsw::make_unique<rcppsw::er::client>(server);
+    module->insmod(name, rcppsw::er::er_lvl::DIAG, rcppsw::er::er_lvl::NOM);
+    it = modules.emplace(server.get(), std::move(module)).first;
+  }
+  cache.emplace(server.get(), it->second.get());
+  return *it->second;
+} /* er_module() */
+
+NS_END(events, fordyca);
+
+#endif /* INCLUDE_FORDYCA_EVENTS_ER_MODULE_HPP_ */
@@ -24,9 +24,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/events/block_drop_event.hpp"
 #include "fordyca/events/cell_op.hpp"
-#include "rcppsw/er/client.hpp"
 #include "rcppsw/math/dcoord.hpp"
 
 /*******************************************************************************
@@ -62,7 +62,6 @@ class free_block_drop : public cell_op,
                   size_t x,
                   size_t y,
                   double resolution);
-  ~free_block_drop(void) override { client::rmmod(); }
 
   free_block_drop(const free_block_drop& op) = delete;
   free_block_drop& operator=(const free_block_drop& op) = delete;
@@ -24,8 +24,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/events/block_drop_event.hpp"
-#include "rcppsw/er/client.hpp"
 #include "rcppsw/patterns/visitor/visitor.hpp"
 
 /*******************************************************************************
@@ -84,7 +84,6 @@ class nest_block_drop
  public:
   nest_block_drop(const std::shared_ptr<rcppsw::er::server>& server,
                   const std::shared_ptr<representation::block>& block);
-  ~nest_block_drop(void) override { client::rmmod(); }
 
   nest_block_drop(const nest_block_drop& op) = delete;
   nest_block_drop& operator=(const nest_block_drop& op) = delete;
@@ -24,16 +24,17 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include "rcppsw/patterns/state_machine/simple_fsm.hpp"
+#include <cstdint>
+#include <cstddef>
+
+#include "rcppsw/common/common.hpp"
 #include "rcppsw/patterns/visitor/visitable.hpp"
-#include "rcsw/common/common.h"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, fsm);
 
-namespace state_machine = rcppsw::patterns::state_machine;
 namespace visitor = rcppsw::patterns::visitor;
 
 /*******************************************************************************
@@ -49,9 +50,15 @@ namespace visitor = rcppsw::patterns::visitor;
  * Though this class processes events, it does not do so via the visitor
  * pattern as it is so simple that using the visitor pattern would be overkill
  * here.
+ *
+ * There is one of these for every cell in every robot's map, so the FSM is
+ * table driven and packs the state and block count into a single word, rather
+ * than being a full state machine object with its own event reporting
+ * handle. Events that can be illegal (picking up a block from a cell without
+ * one, or more blocks than fit in the count) return \c FALSE and leave the
+ * cell as it was, and the event that drove the transition reports the error.
  */
-class cell2D_fsm : public state_machine::simple_fsm,
-                   public visitor::visitable_any<cell2D_fsm> {
+class cell2D_fsm : public visitor::visitable_any<cell2D_fsm> {
  public:
   enum state {
     ST_UNKNOWN,
@@ -61,48 +68,84 @@ class cell2D_fsm : public state_machine::simple_fsm,
     ST_MAX_STATES
   };
 
-  explicit cell2D_fsm(const std::shared_ptr<rcppsw::er::server>& server);
-  cell2D_fsm(void);
-  ~cell2D_fsm(void) override = default;
+  cell2D_fsm(void) : m_state(ST_UNKNOWN), m_block_count(0) {}
   cell2D_fsm(const cell2D_fsm& other) = default;
+  cell2D_fsm& operator=(const cell2D_fsm& other) = default;
 
   bool state_is_known(void) const { return current_state() != ST_UNKNOWN; }
   bool state_has_block(void) const { return current_state() == ST_HAS_BLOCK; }
   bool state_has_cache(void) const { return current_state() == ST_HAS_CACHE; }
   bool state_is_empty(void) const { return current_state() == ST_EMPTY; }
 
+  /**
+   * @brief The largest block count that can be stored in a cell (the count is
+   * 30 bits, so that it fits in a word with the state).
+   */
+  static constexpr size_t kMAX_BLOCK_COUNT = (1U << 30) - 1;
+
   /* events */
-  void event_unknown(void);
-  void event_empty(void);
-  void event_block_pickup(void);
-  void event_block_drop(void);
-  void init(void) override;
+  void event_unknown(void) { transition(EV_UNKNOWN); }
+  void event_empty(void) { transition(EV_EMPTY); }
+
+  /**
+   * @return \c FALSE if the cell does not contain a block/cache.
+   */
+  bool event_block_pickup(void) { return transition(EV_BLOCK_PICKUP); }
+
+  /**
+   * @return \c FALSE if the cell already contains \ref kMAX_BLOCK_COUNT
+   * blocks.
+   */
+  bool event_block_drop(void) { return transition(EV_BLOCK_DROP); }
+  void init(void) { transition(EV_UNKNOWN); }
+
+  /**
+   * @brief Set the number of blocks in the cell directly, rather than via a
+   * sequence of block drop/pickup events (e.g. when synchronizing a perceived
+   * cache with the actual number of blocks it contains).
+   *
+   * 0 blocks is an empty cell, 1 block is a block, and 2 or more blocks is a
+   * cache.
+   *
+   * @return \c FALSE if \p n > \ref kMAX_BLOCK_COUNT.
+   */
+  bool event_block_count(size_t n);
 
+  uint8_t current_state(void) const { return static_cast<uint8_t>(m_state); }
   size_t block_count(void) const { return m_block_count; }
 
  private:
-  struct block_data : public state_machine::event_data {
-    explicit block_data(bool pickup_) : pickup(pickup_) {}
-    bool pickup;
+  enum event {
+    EV_UNKNOWN,
+    EV_EMPTY,
+    EV_BLOCK_DROP,
+    EV_BLOCK_PICKUP,
+    EV_MAX_EVENTS
   };
 
-  FSM_STATE_DECLARE_ND(cell2D_fsm, state_unknown);
-  FSM_STATE_DECLARE_ND(cell2D_fsm, state_empty);
-  FSM_STATE_DECLARE_ND(cell2D_fsm, state_block);
-  FSM_STATE_DECLARE(cell2D_fsm, state_cache, struct block_data);
-
-  FSM_DEFINE_STATE_MAP_ACCESSOR(state_map, index) override {
-    FSM_DEFINE_STATE_MAP(state_map, kSTATE_MAP){
-        FSM_STATE_MAP_ENTRY(&state_unknown),
-        FSM_STATE_MAP_ENTRY(&state_empty),
-        FSM_STATE_MAP_ENTRY(&state_block),
-        FSM_STATE_MAP_ENTRY(&state_cache),
-    };
-    FSM_VERIFY_STATE_MAP(state_map, kSTATE_MAP, ST_MAX_STATES);
-    return &kSTATE_MAP[index];
-  }
-
-  size_t m_block_count;
+  /**
+   * @brief An entry in the transition table: the next state, and how the block
+   * count changes.
+   */
+  struct transition_entry {
+    uint8_t next;
+    int8_t count_delta;
+    bool count_reset;
+  };
+
+  /**
+   * @brief Marks a transition that is illegal from the current state.
+   */
+  static constexpr uint8_t kFATAL = 0xFF;
+
+  static const transition_entry kTRANSITIONS[EV_MAX_EVENTS][ST_MAX_STATES];
+
+  bool transition(event ev);
+
+  // clang-format off
+  uint32_t m_state       : 2;
+  uint32_t m_block_count : 30;
+  // clang-format on
 };
 
 NS_END(fsm, forydca);
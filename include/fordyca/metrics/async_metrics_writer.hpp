@@ -0,0 +1,113 @@
+/**
+ * @file async_metrics_writer.hpp
+ * @ingroup metrics
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_ASYNC_METRICS_WRITER_HPP_
+#define INCLUDE_FORDYCA_METRICS_ASYNC_METRICS_WRITER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "fordyca/metrics/row_writer.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class async_metrics_writer
+ * @ingroup metrics
+ *
+ * @brief Writes rows of metrics to their \ref row_writer on a background
+ * thread, so that file I/O is not done during the simulation step.
+ *
+ * Rows are copied into a fixed ring of slots, whose storage is reused, so
+ * queuing a row does not allocate once the ring has warmed up. If the ring is
+ * full, \ref enqueue() blocks until the writer thread frees a slot, so a slow
+ * filesystem throttles the simulation rather than growing the queue without
+ * bound.
+ *
+ * Writers buffer rows themselves (e.g. \ref columnar_writer fills whole
+ * chunks), and are only flushed by \ref drain() and on destruction, so after
+ * \ref drain() returns all queued rows are on disk.
+ */
+class async_metrics_writer {
+ public:
+  /**
+   * @param depth The maximum number of rows that can be queued.
+   */
+  explicit async_metrics_writer(size_t depth);
+
+  /**
+   * @brief Drain the queue and stop the writer thread.
+   */
+  ~async_metrics_writer(void);
+
+  async_metrics_writer(const async_metrics_writer& other) = delete;
+  async_metrics_writer& operator=(const async_metrics_writer& other) = delete;
+
+  /**
+   * @brief Queue a copy of a row to be written by the specified writer, which
+   * must remain valid until the row has been written (see \ref drain()).
+   */
+  void enqueue(row_writer* writer, const metrics_row& row);
+
+  /**
+   * @brief Block until all queued rows have been written and flushed.
+   */
+  void drain(void);
+
+ private:
+  struct slot {
+    row_writer* writer;
+    metrics_row row;
+  };
+
+  void thread_main(void);
+
+  // clang-format off
+  std::vector<slot>        m_slots;
+  std::vector<row_writer*> m_dirty{};
+  std::vector<row_writer*> m_flushing{};
+  size_t                   m_head{0};
+  size_t                   m_count{0};
+  bool                     m_busy{false};
+  bool                     m_flush{false};
+  bool                     m_stop{false};
+  std::mutex               m_mtx{};
+  std::condition_variable  m_not_empty{};
+  std::condition_variable  m_not_full{};
+  std::condition_variable  m_idle{};
+  std::thread              m_thread{};
+  // clang-format on
+};
+
+NS_END(metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_ASYNC_METRICS_WRITER_HPP_ */
@@ -25,7 +25,7 @@
  * Includes
  ******************************************************************************/
 #include <string>
-#include "rcppsw/metrics/base_metrics_collector.hpp"
+#include "fordyca/metrics/typed_metrics_collector.hpp"
 #include "rcppsw/patterns/visitor/visitable.hpp"
 
 /*******************************************************************************
@@ -46,7 +46,7 @@ namespace visitor = rcppsw::patterns::visitor;
  * Metrics are written out at the specified interval.
  */
 class block_metrics_collector
-    : public rcppsw::metrics::base_metrics_collector,
+    : public typed_metrics_collector,
       public visitor::visitable_any<block_metrics_collector> {
  public:
   /**
@@ -66,8 +66,8 @@ class block_metrics_collector
     uint cum_carries;   /* aggregate across blocks, not reset each timstep */
   };
 
-  std::string csv_header_build(const std::string& header) override;
-  bool csv_line_build(std::string& line) override;
+  column_schema columns(void) const override;
+  bool row_build(metrics_row& row) override;
   struct block_metrics m_metrics;
 };
 
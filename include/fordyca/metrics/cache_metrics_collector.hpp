@@ -27,7 +27,7 @@
 #include <set>
 #include <string>
 
-#include "rcppsw/metrics/base_metrics_collector.hpp"
+#include "fordyca/metrics/typed_metrics_collector.hpp"
 #include "rcppsw/patterns/visitor/visitable.hpp"
 
 /*******************************************************************************
@@ -49,7 +49,7 @@ namespace visitor = rcppsw::patterns::visitor;
  * Metrics are output at the specified interval.
  */
 class cache_metrics_collector
-    : public rcppsw::metrics::base_metrics_collector,
+    : public typed_metrics_collector,
       public visitor::visitable_any<cache_metrics_collector> {
  public:
   /**
@@ -73,8 +73,8 @@ class cache_metrics_collector
     uint n_penalty_steps;
   };
 
-  std::string csv_header_build(const std::string& header) override;
-  bool csv_line_build(std::string& line) override;
+  column_schema columns(void) const override;
+  bool row_build(metrics_row& row) override;
 
   // clang-format off
   uint           m_penalty_count{0};
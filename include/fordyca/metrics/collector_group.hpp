@@ -0,0 +1,91 @@
+/**
+ * @file collector_group.hpp
+ * @ingroup metrics
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_COLLECTOR_GROUP_HPP_
+#define INCLUDE_FORDYCA_METRICS_COLLECTOR_GROUP_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <map>
+#include <memory>
+#include <string>
+
+#include "fordyca/metrics/typed_metrics_collector.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class collector_group
+ * @ingroup metrics
+ *
+ * @brief A named set of \ref typed_metrics_collector objects that are reset,
+ * written, and finalized together. Same interface as the rcppsw collector
+ * group, which only manages its own CSV stream collectors.
+ */
+class collector_group {
+ public:
+  collector_group(void) = default;
+
+  collector_group(const collector_group& other) = delete;
+  collector_group& operator=(const collector_group& other) = delete;
+
+  /**
+   * @brief Create a collector and add it to the group. Any existing collector
+   * of the same name is replaced.
+   */
+  template <typename T>
+  void register_collector(const std::string& name,
+                          const std::string& fname,
+                          uint interval) {
+    m_collectors[name] = rcppsw::make_unique<T>(fname, interval);
+  }
+
+  /**
+   * @brief Get a collector by name, or NULL if there is no such collector.
+   */
+  typed_metrics_collector* operator[](const std::string& name) const;
+
+  void reset_all(void);
+  void metrics_write_all(uint clock);
+  void timestep_reset_all(void);
+  void interval_reset_all(void);
+  void timestep_inc_all(void);
+  void finalize_all(void);
+
+ private:
+  using collector_map =
+      std::map<std::string, std::unique_ptr<typed_metrics_collector>>;
+
+  // clang-format off
+  collector_map m_collectors{};
+  // clang-format on
+};
+
+NS_END(metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_COLLECTOR_GROUP_HPP_ */
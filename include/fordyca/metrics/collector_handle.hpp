@@ -0,0 +1,76 @@
+/**
+ * @file collector_handle.hpp
+ * @ingroup metrics
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_COLLECTOR_HANDLE_HPP_
+#define INCLUDE_FORDYCA_METRICS_COLLECTOR_HANDLE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/common/common.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class collector_handle
+ * @ingroup metrics
+ *
+ * @brief A typed reference to a collector in a collector group, resolved once
+ * when the collector is registered, so that collecting from it does not
+ * require looking it up by name.
+ *
+ * The collector group owns the collector, and must outlive the handle. A
+ * default constructed handle refers to nothing, and must not be used.
+ */
+template <typename T>
+class collector_handle {
+ public:
+  collector_handle(void) = default;
+  explicit collector_handle(T* collector) : m_collector(collector) {}
+
+  /**
+   * @brief Collect metrics from the specified object; equivalent to looking
+   * the collector up in its \ref collector_group by name and collecting.
+   */
+  template <typename M>
+  void collect(const M& metrics) const {
+    m_collector->collect(metrics);
+  }
+
+  T& operator*(void) const { return *m_collector; }
+  T* operator->(void) const { return m_collector; }
+  explicit operator bool(void) const { return nullptr != m_collector; }
+
+ private:
+  // clang-format off
+  T* m_collector{nullptr};
+  // clang-format on
+};
+
+NS_END(metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_COLLECTOR_HANDLE_HPP_ */
@@ -0,0 +1,103 @@
+/**
+ * @file columnar_writer.hpp
+ * @ingroup metrics
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_COLUMNAR_WRITER_HPP_
+#define INCLUDE_FORDYCA_METRICS_COLUMNAR_WRITER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "fordyca/metrics/row_writer.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class columnar_writer
+ * @ingroup metrics
+ *
+ * @brief Writes rows of metrics to a binary columnar file.
+ *
+ * The file consists of a schema header followed by zero or more chunks. All
+ * integers are in host byte order:
+ *
+ * - Header: kMAGIC (u64), kVERSION (u32), number of columns (u32), and then for
+ *   each column its \ref column_type (u8), the length of its name (u32), and
+ *   its name (not NULL terminated).
+ *
+ * - Chunk: the number of rows in the chunk (u32), and then for each column (in
+ *   schema order) the values of that column for all rows in the chunk, as u64
+ *   or IEEE 754 doubles.
+ *
+ * Rows are buffered until a chunk is full, or the writer is flushed/destroyed.
+ * Use the fcol2csv tool to convert a file to CSV.
+ */
+class columnar_writer : public row_writer {
+ public:
+  /* "FDYCOL01" when read as bytes on a little endian host */
+  static constexpr uint64_t kMAGIC = 0x31304c4f43594446;
+  static constexpr uint32_t kVERSION = 1;
+  static constexpr size_t kCHUNK_ROWS = 1024;
+
+  /**
+   * @param fname The output file, which is truncated.
+   * @param schema The columns that each row written will contain.
+   */
+  columnar_writer(const std::string& fname, const column_schema& schema);
+  ~columnar_writer(void) override;
+
+  /**
+   * @brief Buffer a row, writing out a chunk if the buffer is full. The row
+   * must match the schema.
+   */
+  void row_write(const metrics_row& row) override;
+
+  /**
+   * @brief Write out all buffered rows as a (possibly partial) chunk.
+   */
+  void flush(void) override;
+
+ private:
+  template <typename T>
+  void raw_write(const T& value) {
+    m_ofile.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  void header_write(void);
+
+  // clang-format off
+  std::ofstream                      m_ofile;
+  column_schema                      m_schema;
+  std::vector<std::vector<uint64_t>> m_columns;
+  // clang-format on
+};
+
+NS_END(metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_COLUMNAR_WRITER_HPP_ */
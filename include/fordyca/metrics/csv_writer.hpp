@@ -0,0 +1,80 @@
+/**
+ * @file csv_writer.hpp
+ * @ingroup metrics
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_CSV_WRITER_HPP_
+#define INCLUDE_FORDYCA_METRICS_CSV_WRITER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <fstream>
+#include <string>
+
+#include "fordyca/metrics/row_writer.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class csv_writer
+ * @ingroup metrics
+ *
+ * @brief Writes rows of metrics to a CSV file, with a header built from the
+ * column names. Every field (including the last) is followed by the separator.
+ */
+class csv_writer : public row_writer {
+ public:
+  /**
+   * @param fname The output file, which is truncated.
+   * @param schema The columns that each row written will contain.
+   * @param separator The field separator.
+   */
+  csv_writer(const std::string& fname,
+             const column_schema& schema,
+             const std::string& separator)
+      : m_ofile(fname, std::ios::trunc), m_separator(separator) {
+    for (auto& c : schema) {
+      m_ofile << c.name << m_separator;
+    } /* for(&c..) */
+    m_ofile << "\n";
+  }
+  ~csv_writer(void) override { flush(); }
+
+  void row_write(const metrics_row& row) override {
+    m_ofile << row.csv(m_separator) << "\n";
+  }
+  void flush(void) override { m_ofile.flush(); }
+
+ private:
+  // clang-format off
+  std::ofstream     m_ofile;
+  const std::string m_separator;
+  // clang-format on
+};
+
+NS_END(metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_CSV_WRITER_HPP_ */
@@ -27,8 +27,8 @@
 #include <string>
 #include <vector>
 
+#include "fordyca/metrics/typed_metrics_collector.hpp"
 #include "rcppsw/patterns/visitor/visitable.hpp"
-#include "rcppsw/metrics/base_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -51,7 +51,7 @@ NS_START(fsm);
  *
  * Metrics are written out every timestep.
  */
-class distance_metrics_collector : public rcppsw::metrics::base_metrics_collector,
+class distance_metrics_collector : public metrics::typed_metrics_collector,
                                    public visitor::visitable_any<distance_metrics_collector> {
  public:
   /**
@@ -69,8 +69,8 @@ class distance_metrics_collector : public rcppsw::metrics::base_metrics_collecto
     double cum_distance;
   };
 
-  std::string csv_header_build(const std::string& header) override;
-  bool csv_line_build(std::string& line) override;
+  column_schema columns(void) const override;
+  bool row_build(metrics_row& row) override;
 
   struct robot_stats m_stats;
 };
@@ -25,7 +25,8 @@
  * Includes
  ******************************************************************************/
 #include <string>
-#include "rcppsw/metrics/base_metrics_collector.hpp"
+
+#include "fordyca/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -44,7 +45,7 @@ NS_START(fordyca, metrics, fsm);
  * Metrics are written out every timestep, or at the end of the specified
  * interval, depending.
  */
-class stateless_metrics_collector : public rcppsw::metrics::base_metrics_collector {
+class stateless_metrics_collector : public metrics::typed_metrics_collector {
  public:
   /**
    * @param ofname Output file name.
@@ -69,8 +70,8 @@ class stateless_metrics_collector : public rcppsw::metrics::base_metrics_collect
     size_t n_cum_transporting_to_nest;
   };
 
-  std::string csv_header_build(const std::string& header) override;
-  bool csv_line_build(std::string& line) override;
+  column_schema columns(void) const override;
+  bool row_build(metrics_row& row) override;
 
   struct sim_stats m_stats;
 };
@@ -0,0 +1,136 @@
+/**
+ * @file metrics_row.hpp
+ * @ingroup metrics
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_METRICS_ROW_HPP_
+#define INCLUDE_FORDYCA_METRICS_METRICS_ROW_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "rcppsw/common/common.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/**
+ * @brief The type of the values in a metrics column. The numeric values are
+ * part of the binary columnar file format, and must not be changed.
+ */
+enum class column_type : uint8_t {
+  kUINT = 0,
+  kDOUBLE = 1
+};
+
+/**
+ * @struct column
+ * @ingroup metrics
+ *
+ * @brief The definition of a single column of metrics output: its name (the
+ * CSV header), and the type of its values.
+ */
+struct column {
+  std::string name;
+  column_type type;
+};
+
+using column_schema = std::vector<column>;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class metrics_row
+ * @ingroup metrics
+ *
+ * @brief A single row of typed metrics values, in the order of the columns of
+ * the \ref column_schema of the collector that built it.
+ *
+ * Values are stored as their raw 64-bit representation, so a row can be
+ * reused from timestep to timestep without allocating, and written out as
+ * either CSV or binary.
+ */
+class metrics_row {
+ public:
+  metrics_row(void) : m_types(), m_values() {}
+
+  void clear(void) {
+    m_types.clear();
+    m_values.clear();
+  }
+  size_t size(void) const { return m_values.size(); }
+
+  void uint_add(uint64_t value) {
+    m_types.push_back(column_type::kUINT);
+    m_values.push_back(value);
+  }
+  void double_add(double value) {
+    uint64_t raw;
+    std::memcpy(&raw, &value, sizeof(raw));
+    m_types.push_back(column_type::kDOUBLE);
+    m_values.push_back(raw);
+  }
+
+  column_type type(size_t i) const { return m_types[i]; }
+
+  /**
+   * @brief Get the raw 64-bit representation of the i-th value.
+   */
+  uint64_t raw(size_t i) const { return m_values[i]; }
+
+  /**
+   * @brief Build a CSV line from the row. Each value is followed by the
+   * separator.
+   */
+  std::string csv(const std::string& separator) const {
+    std::string line;
+    for (size_t i = 0; i < m_values.size(); ++i) {
+      if (column_type::kUINT == m_types[i]) {
+        line += std::to_string(m_values[i]);
+      } else {
+        double value;
+        std::memcpy(&value, &m_values[i], sizeof(value));
+        line += std::to_string(value);
+      }
+      line += separator;
+    } /* for(i..) */
+    return line;
+  }
+
+ private:
+  // clang-format off
+  std::vector<column_type> m_types;
+  std::vector<uint64_t>    m_values;
+  // clang-format on
+};
+
+NS_END(metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_METRICS_ROW_HPP_ */
@@ -0,0 +1,66 @@
+/**
+ * @file row_writer.hpp
+ * @ingroup metrics
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_ROW_WRITER_HPP_
+#define INCLUDE_FORDYCA_METRICS_ROW_WRITER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/metrics/metrics_row.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class row_writer
+ * @ingroup metrics
+ *
+ * @brief Interface for writing rows of metrics matching a \ref column_schema
+ * to a file, in some output format.
+ */
+class row_writer {
+ public:
+  row_writer(void) = default;
+  virtual ~row_writer(void) = default;
+
+  row_writer(const row_writer& other) = delete;
+  row_writer& operator=(const row_writer& other) = delete;
+
+  /**
+   * @brief Write (or buffer) a row. The row must match the schema.
+   */
+  virtual void row_write(const metrics_row& row) = 0;
+
+  /**
+   * @brief Write out all buffered rows.
+   */
+  virtual void flush(void) = 0;
+};
+
+NS_END(metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_ROW_WRITER_HPP_ */
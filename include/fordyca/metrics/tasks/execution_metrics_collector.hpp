@@ -27,7 +27,7 @@
 #include <string>
 #include <vector>
 
-#include "rcppsw/metrics/base_metrics_collector.hpp"
+#include "fordyca/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -46,7 +46,7 @@ NS_START(fordyca, metrics, tasks);
  * Collects metrics about tasks as they are executed. Metrics are written out at
  * the specified interval, or every timestep, depending.
  */
-class execution_metrics_collector : public rcppsw::metrics::base_metrics_collector {
+class execution_metrics_collector : public metrics::typed_metrics_collector {
  public:
   /**
    * @param ofname Output file name.
@@ -77,8 +77,8 @@ class execution_metrics_collector : public rcppsw::metrics::base_metrics_collect
     uint cum_collector_delay;
     uint cum_harvester_delay;
   };
-  std::string csv_header_build(const std::string& header) override;
-  bool csv_line_build(std::string& line) override;
+  column_schema columns(void) const override;
+  bool row_build(metrics_row& row) override;
 
   struct count_stats m_count_stats;
   struct interface_stats m_int_stats;
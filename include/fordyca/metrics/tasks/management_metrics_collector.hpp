@@ -27,7 +27,7 @@
 #include <string>
 #include <vector>
 
-#include "rcppsw/metrics/base_metrics_collector.hpp"
+#include "fordyca/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -47,7 +47,7 @@ NS_START(fordyca, metrics, tasks);
  * executive/controller. Metrics are written out at the specified interval, or
  * every timestep, depending.
  */
-class management_metrics_collector : public rcppsw::metrics::base_metrics_collector {
+class management_metrics_collector : public metrics::typed_metrics_collector {
  public:
   /**
    * @param ofname Output file name.
@@ -87,8 +87,8 @@ class management_metrics_collector : public rcppsw::metrics::base_metrics_collec
     uint cum_task_exec_time;
   };
 
-  std::string csv_header_build(const std::string& header) override;
-  bool csv_line_build(std::string& line) override;
+  column_schema columns(void) const override;
+  bool row_build(metrics_row& row) override;
 
   struct subtask_selection_stats m_sel_stats;
   struct partitioning_stats m_partition_stats;
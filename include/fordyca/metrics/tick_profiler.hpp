@@ -0,0 +1,212 @@
+/**
+ * @file tick_profiler.hpp
+ * @ingroup metrics
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_TICK_PROFILER_HPP_
+#define INCLUDE_FORDYCA_METRICS_TICK_PROFILER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include "rcppsw/common/common.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/**
+ * @brief The parts of a simulation timestep that are profiled.
+ */
+enum class tick_phase : uint8_t {
+  kPROCESS_LOS,
+  kGRID_UPDATE,
+  kEXECUTIVE_RUN,
+  kARENA_INTERACT,
+  kFLOOR_COLOR,
+  kMETRICS_WRITE,
+  kMAX_PHASES
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class latency_histogram
+ * @ingroup metrics
+ *
+ * @brief A log-linear histogram of latencies in nanoseconds, in the style of
+ * HdrHistogram.
+ *
+ * Values below 2 * \ref kSUB_BUCKETS are counted exactly. Above that, each
+ * power of two is split into \ref kSUB_BUCKETS equal buckets, so every value
+ * is recorded to within 1 / \ref kSUB_BUCKETS (~3%) of its true value,
+ * regardless of magnitude, in a fixed amount of memory.
+ *
+ * Recording is lock-free, so values can be recorded from multiple threads
+ * (e.g. robot controllers) at once.
+ */
+class latency_histogram {
+ public:
+  static constexpr size_t kSUB_BUCKET_BITS = 5;
+  static constexpr size_t kSUB_BUCKETS = 1U << kSUB_BUCKET_BITS;
+  static constexpr size_t kN_BUCKETS =
+      kSUB_BUCKETS * (64 - kSUB_BUCKET_BITS + 1);
+
+  latency_histogram(void) { reset(); }
+
+  latency_histogram(const latency_histogram& other) = delete;
+  latency_histogram& operator=(const latency_histogram& other) = delete;
+
+  void record(uint64_t ns);
+  void reset(void);
+
+  uint64_t count(void) const { return m_count.load(); }
+  uint64_t min(void) const;
+  uint64_t max(void) const { return m_max.load(); }
+  double mean(void) const;
+
+  /**
+   * @brief Get the value at the specified percentile (0, 100], as the largest
+   * value that would have been counted in the same bucket.
+   */
+  uint64_t percentile(double p) const;
+
+  /**
+   * @brief The smallest/largest values counted in a bucket.
+   */
+  static uint64_t bucket_lower(size_t index);
+  static uint64_t bucket_upper(size_t index);
+  uint64_t bucket_count(size_t index) const { return m_buckets[index].load(); }
+
+ private:
+  static size_t bucket_index(uint64_t ns);
+
+  // clang-format off
+  std::array<std::atomic<uint64_t>, kN_BUCKETS> m_buckets;
+  std::atomic<uint64_t>                         m_count{0};
+  std::atomic<uint64_t>                         m_sum{0};
+  std::atomic<uint64_t>                         m_min{0};
+  std::atomic<uint64_t>                         m_max{0};
+  // clang-format on
+};
+
+/**
+ * @class tick_profiler
+ * @ingroup metrics
+ *
+ * @brief Collects per-\ref tick_phase latency histograms for the whole
+ * simulation. There is a single instance, so that phases run by the robot
+ * controllers and the loop functions are reported together.
+ *
+ * Profiling is disabled by default; when disabled, \ref phase_timer only checks
+ * a flag.
+ */
+class tick_profiler {
+ public:
+  static tick_profiler& instance(void);
+
+  tick_profiler(const tick_profiler& other) = delete;
+  tick_profiler& operator=(const tick_profiler& other) = delete;
+
+  bool enabled(void) const {
+    return m_enabled.load(std::memory_order_relaxed);
+  }
+  void enabled(bool b) { m_enabled.store(b, std::memory_order_relaxed); }
+
+  void record(tick_phase phase, uint64_t ns) {
+    m_phases[static_cast<size_t>(phase)].record(ns);
+  }
+
+  /**
+   * @brief Clear all recorded latencies.
+   */
+  void reset(void);
+
+  /**
+   * @brief Write a summary (count, min, mean, percentiles, max) for each phase
+   * to the specified file, and, if \p hist_fname is not empty, all non-empty
+   * histogram buckets for each phase to that file.
+   */
+  void write(const std::string& fname, const std::string& hist_fname) const;
+
+  static const char* phase_name(tick_phase phase);
+
+ private:
+  tick_profiler(void) = default;
+
+  // clang-format off
+  std::atomic<bool> m_enabled{false};
+  std::array<latency_histogram,
+             static_cast<size_t>(tick_phase::kMAX_PHASES)> m_phases{};
+  // clang-format on
+};
+
+/**
+ * @class phase_timer
+ * @ingroup metrics
+ *
+ * @brief Records the time between its construction and destruction as a
+ * latency for the specified phase, if profiling is enabled.
+ */
+class phase_timer {
+ public:
+  explicit phase_timer(tick_phase phase)
+      : m_phase(phase),
+        m_enabled(tick_profiler::instance().enabled()),
+        m_start() {
+    if (m_enabled) {
+      m_start = std::chrono::steady_clock::now();
+    }
+  }
+
+  ~phase_timer(void) {
+    if (m_enabled) {
+      auto elapsed = std::chrono::steady_clock::now() - m_start;
+      tick_profiler::instance().record(
+          m_phase,
+          static_cast<uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                  .count()));
+    }
+  }
+
+  phase_timer(const phase_timer& other) = delete;
+  phase_timer& operator=(const phase_timer& other) = delete;
+
+ private:
+  // clang-format off
+  const tick_phase                      m_phase;
+  const bool                            m_enabled;
+  std::chrono::steady_clock::time_point m_start;
+  // clang-format on
+};
+
+NS_END(metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_TICK_PROFILER_HPP_ */
@@ -0,0 +1,165 @@
+/**
+ * @file typed_metrics_collector.hpp
+ * @ingroup metrics
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_TYPED_METRICS_COLLECTOR_HPP_
+#define INCLUDE_FORDYCA_METRICS_TYPED_METRICS_COLLECTOR_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <memory>
+#include <string>
+
+#include "fordyca/metrics/metrics_row.hpp"
+#include "fordyca/metrics/row_writer.hpp"
+#include "rcppsw/metrics/base_metrics.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+class async_metrics_writer;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class typed_metrics_collector
+ * @ingroup metrics
+ *
+ * @brief Base class for collectors that define their output as a fixed set of
+ * typed columns, rather than building CSV lines directly.
+ *
+ * The same column definitions are used to write either CSV (the default), or,
+ * if the output file name ends in \ref kBINARY_EXT, a binary columnar file
+ * (see \ref columnar_writer). The collector owns its output file; it has the
+ * same collection hooks as the rcppsw CSV collectors, but does not derive from
+ * them, and is managed by a \ref collector_group.
+ *
+ * If an \ref async_metrics_writer is attached, rows are handed off to it
+ * instead of being written during the simulation step.
+ */
+class typed_metrics_collector {
+ public:
+  static constexpr char kBINARY_EXT[] = ".fcol";
+
+  /**
+   * @param ofname Output file name.
+   * @param interval Collection interval.
+   */
+  typed_metrics_collector(const std::string& ofname, uint interval);
+  virtual ~typed_metrics_collector(void) = default;
+
+  typed_metrics_collector(const typed_metrics_collector& other) = delete;
+  typed_metrics_collector& operator=(const typed_metrics_collector& other) =
+      delete;
+
+  /**
+   * @brief Collect metrics from an object.
+   */
+  virtual void collect(const rcppsw::metrics::base_metrics& metrics) = 0;
+
+  /**
+   * @brief (Re)create the output file, write its header, and reset the
+   * timestep.
+   */
+  virtual void reset(void);
+
+  /**
+   * @brief Reset metrics that are gathered each timestep.
+   */
+  virtual void reset_after_timestep(void) {}
+
+  /**
+   * @brief Reset metrics that are gathered over an interval.
+   */
+  virtual void reset_after_interval(void) {}
+
+  /**
+   * @brief Write out the current row, if \ref row_build() says there is one.
+   *
+   * @param clock The current simulation clock, written as the first column.
+   */
+  void metrics_write(uint clock);
+
+  void timestep_inc(void) { ++m_timestep; }
+  void timestep_reset(void) { reset_after_timestep(); }
+
+  /**
+   * @brief Call \ref reset_after_interval() if the current timestep is the
+   * last one in a collection interval.
+   */
+  void interval_reset(void);
+
+  /**
+   * @brief Write out any buffered rows and close the output file.
+   */
+  void finalize(void);
+
+  uint timestep(void) const { return m_timestep; }
+  uint interval(void) const { return m_interval; }
+  const std::string& separator(void) const { return m_separator; }
+
+  /**
+   * @brief If TRUE, output is written as binary columns instead of CSV.
+   */
+  bool binary(void) const { return m_binary; }
+
+  /**
+   * @brief Write rows via the specified writer (or synchronously, if NULL),
+   * which must outlive the collector.
+   */
+  void async_writer(async_metrics_writer* writer) { m_async = writer; }
+
+ protected:
+  /**
+   * @brief The columns written by the collector, in the order that \ref
+   * row_build() adds their values. The simulation clock column is added
+   * automatically.
+   */
+  virtual column_schema columns(void) const = 0;
+
+  /**
+   * @brief Add the values of the current row to the (empty) row.
+   *
+   * @return \c TRUE iff the row should be written out this timestep.
+   */
+  virtual bool row_build(metrics_row& row) = 0;
+
+ private:
+  static bool is_binary(const std::string& ofname);
+
+  // clang-format off
+  const uint                  m_interval;
+  const bool                  m_binary;
+  const std::string           m_ofname;
+  const std::string           m_separator{";"};
+  uint                        m_timestep{0};
+  metrics_row                 m_row{};
+  std::unique_ptr<row_writer> m_writer{};
+  async_metrics_writer*       m_async{nullptr};
+  // clang-format on
+};
+
+NS_END(metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_TYPED_METRICS_COLLECTOR_HPP_ */
@@ -45,6 +45,7 @@ struct occupancy_grid_params : public rcppsw::common::base_params {
 
   struct grid_params grid;
   struct pheromone_params pheromone;
+  bool shared_baseline{false};
 };
 
 NS_END(depth0, params, fordyca);
@@ -44,6 +44,7 @@ struct pheromone_params : public rcppsw::common::base_params {
 
   double rho{0.0};
   bool repeat_deposit{false};
+  bool lazy_decay{false};
 };
 
 NS_END(depth0, params, fordyca);
@@ -0,0 +1,112 @@
+/**
+ * @file shared_repository.hpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_PARAMS_SHARED_REPOSITORY_HPP_
+#define INCLUDE_FORDYCA_PARAMS_SHARED_REPOSITORY_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <argos3/core/utility/configuration/argos_configuration.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <tuple>
+#include <typeindex>
+
+#include "rcppsw/common/common.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, params);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class shared_repository
+ * @ingroup params
+ *
+ * @brief A cache of parsed and validated parameter repositories, shared by all
+ * robots initialized from the same configuration document.
+ *
+ * All robots using the same controller configuration are initialized from the
+ * same XML node, so each type of repository only needs to be parsed (and shown
+ * in the log) once per node, rather than once per robot. Repositories are
+ * keyed by the document that owns the node, the identity of the node, and
+ * their type. They live until they are released for their document, which the
+ * loop functions do in Destroy(); until then the parameters they contain can
+ * be referenced by pointer from anywhere. Releasing a document before it is
+ * freed keeps a later document allocated at the same address from being
+ * handed repositories parsed from this one.
+ *
+ * A shared repository must not be re-parsed; the parameter structs obtained
+ * from it are const, and are shared by all robots.
+ */
+class shared_repository {
+ public:
+  /**
+   * @brief Get the repository of type \c T for the specified node, parsing it,
+   * showing it in the specified log stream, and validating it if this is the
+   * first time it has been requested.
+   *
+   * @return The repository, or NULL if not all parameters were validated.
+   */
+  template <typename T>
+  static T* get(argos::TConfigurationNode& node, std::ostream& log) {
+    std::lock_guard<std::mutex> lock(mutex());
+    key_type key(node.GetTiXmlPointer()->GetDocument(),
+                 node.GetTiXmlPointer(),
+                 std::type_index(typeid(T)));
+    auto it = repos().find(key);
+    if (it == repos().end()) {
+      auto repo = std::make_shared<T>();
+      repo->parse_all(node);
+      repo->show_all(log);
+      bool valid = repo->validate_all();
+      it = repos().emplace(key, entry{repo, valid}).first;
+    }
+    return (it->second.valid) ? static_cast<T*>(it->second.repo.get())
+                              : nullptr;
+  }
+
+  /**
+   * @brief Release all repositories parsed from nodes in the document that
+   * owns the specified node. Parameters obtained from them must not be used
+   * afterwards.
+   */
+  static void release(argos::TConfigurationNode& node);
+
+ private:
+  struct entry {
+    std::shared_ptr<void> repo;
+    bool valid;
+  };
+  using key_type = std::tuple<const void*, const void*, std::type_index>;
+
+  static std::mutex& mutex(void);
+  static std::map<key_type, entry>& repos(void);
+};
+
+NS_END(params, fordyca);
+
+#endif /* INCLUDE_FORDYCA_PARAMS_SHARED_REPOSITORY_HPP_ */
@@ -25,22 +25,161 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include "rcppsw/ds/grid2D_ptr.hpp"
+#include <utility>
+#include <vector>
+
+#include "fordyca/representation/cell2D.hpp"
+#include "fordyca/representation/tiled_grid.hpp"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
-namespace rcppsw { namespace er {
-class server;
-}} // namespace rcppsw::er
 NS_START(fordyca, representation);
-class cell2D;
 
 /*******************************************************************************
- * Type Definitions
+ * Class Definitions
  ******************************************************************************/
-using arena_grid =
-    rcppsw::ds::grid2D_ptr<cell2D, std::shared_ptr<rcppsw::er::server>&>;
+/**
+ * @class arena_grid_view
+ * @ingroup representation
+ *
+ * @brief A rectangular region of an \ref arena_grid (i.e. a robot's LOS),
+ * which may span several tiles of the grid, as read-only pointers to the cells
+ * in it.
+ */
+class arena_grid_view {
+ public:
+  arena_grid_view(void) = default;
+  arena_grid_view(size_t xsize, size_t ysize)
+      : m_xsize(xsize), m_ysize(ysize), m_cells(xsize * ysize, nullptr) {}
+
+  /**
+   * @brief Change the dimensions of the view, re-using its cell buffer if it
+   * is large enough. The cells in the view are unspecified afterwards.
+   */
+  void reshape(size_t xsize, size_t ysize) {
+    m_xsize = xsize;
+    m_ysize = ysize;
+    m_cells.resize(xsize * ysize);
+  }
+
+  size_t xsize(void) const { return m_xsize; }
+  size_t ysize(void) const { return m_ysize; }
+  size_t size(void) const { return m_cells.size(); }
+
+  const cell2D* operator()(size_t i, size_t j) const {
+    return m_cells[i * m_ysize + j];
+  }
+  const cell2D*& operator()(size_t i, size_t j) {
+    return m_cells[i * m_ysize + j];
+  }
+
+ private:
+  // clang-format off
+  size_t                     m_xsize{0};
+  size_t                     m_ysize{0};
+  std::vector<const cell2D*> m_cells{};
+  // clang-format on
+};
+
+/**
+ * @class arena_grid
+ * @ingroup representation
+ *
+ * @brief The discretized arena: a \ref cell2D for each cell, stored as tiles
+ * which are only allocated when one of their cells is written to (e.g. a block
+ * is dropped in it), or is part of a robot's LOS (see \ref
+ * subcircle_allocate()).
+ *
+ * Cells start out EMPTY, so cells of tiles that have never been allocated are
+ * empty, and large arenas with sparse block distributions only use memory for
+ * the areas that robots and blocks have actually been in. Reading a cell of an
+ * unallocated tile via the const \ref access() returns a shared EMPTY cell,
+ * whose location is (0, 0) rather than that of the cell read.
+ *
+ * The grid is not copyable, and tiles are never freed, so pointers to cells
+ * remain valid for the lifetime of the grid.
+ */
+class arena_grid {
+ public:
+  arena_grid(double resolution, size_t x_max, size_t y_max);
+
+  arena_grid(const arena_grid& other) = delete;
+  arena_grid& operator=(const arena_grid& other) = delete;
+
+  cell2D& access(size_t i, size_t j) { return m_cells.access(i, j); }
+  const cell2D& access(size_t i, size_t j) const {
+    return m_cells.access(i, j);
+  }
+
+  /**
+   * @brief Apply \c f(i, j, cell) to each cell of the tiles that have been
+   * allocated, one tile at a time. Cells of unallocated tiles are all EMPTY.
+   */
+  template <typename F>
+  void for_each_allocated(const F& f) {
+    m_cells.for_each_allocated(f);
+  }
+  template <typename F>
+  void for_each_allocated(const F& f) const {
+    m_cells.for_each_allocated(f);
+  }
+
+  /**
+   * @brief Allocate the tiles covered by \ref subcircle() for the same
+   * arguments.
+   */
+  void subcircle_allocate(size_t x, size_t y, size_t radius);
+
+  /**
+   * @brief Get the square region of cells within \c radius cells of (x, y),
+   * clamped to the grid.
+   *
+   * Only reads the grid, so it can be called for many regions in parallel. The
+   * tiles the region covers must have been allocated beforehand via \ref
+   * subcircle_allocate(), so that the cells in it have their locations set.
+   */
+  arena_grid_view subcircle(size_t x, size_t y, size_t radius) const;
+
+  /**
+   * @brief As \ref subcircle(), but (re)fills an existing view in place, so
+   * that re-targeting a view each timestep does not allocate.
+   */
+  void subcircle(size_t x,
+                 size_t y,
+                 size_t radius,
+                 arena_grid_view* view) const;
+
+  size_t xdsize(void) const { return m_cells.xdsize(); }
+  size_t ydsize(void) const { return m_cells.ydsize(); }
+  size_t xrsize(void) const { return m_xrsize; }
+  size_t yrsize(void) const { return m_yrsize; }
+  double resolution(void) const { return m_resolution; }
+
+  /**
+   * @brief Get the # of tiles that have been allocated, out of \ref
+   * n_tiles().
+   */
+  size_t n_allocated_tiles(void) const { return m_cells.n_allocated_tiles(); }
+  size_t n_tiles(void) const { return m_cells.n_tiles(); }
+
+ private:
+  /**
+   * @brief Get the [lower, upper) bounds of the region returned by \ref
+   * subcircle().
+   */
+  std::pair<rcppsw::math::dcoord2, rcppsw::math::dcoord2> subcircle_bounds(
+      size_t x,
+      size_t y,
+      size_t radius) const;
+
+  // clang-format off
+  double             m_resolution;
+  size_t             m_xrsize;
+  size_t             m_yrsize;
+  tiled_grid<cell2D> m_cells;
+  // clang-format on
+};
 
 NS_END(representation, fordyca);
 
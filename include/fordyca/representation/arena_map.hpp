@@ -24,14 +24,17 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/params/depth1/cache_params.hpp"
 #include "fordyca/representation/arena_cache.hpp"
 #include "fordyca/representation/arena_grid.hpp"
 #include "fordyca/representation/block.hpp"
+#include "fordyca/representation/floor_raster.hpp"
 #include "fordyca/support/block_distributor.hpp"
-#include "rcppsw/er/client.hpp"
 #include "rcppsw/patterns/visitor/visitable.hpp"
 
 /*******************************************************************************
@@ -80,6 +83,7 @@ class arena_map : public rcppsw::er::client,
    * active.
    */
   cache_vector& caches(void) { return m_caches; }
+  const cache_vector& caches(void) const { return m_caches; }
 
   /**
    * @brief Remove a cache from the list of caches.
@@ -154,6 +158,11 @@ class arena_map : public rcppsw::er::client,
    * robot. This happens during initialization when the robot's sensors have not
    * yet been properly initialized by ARGoS.
    *
+   * Only the cells of the arena grid within reach of the largest block extent
+   * around the robot are searched, rather than all blocks in the arena; the
+   * grid cells are kept up to date with the blocks/caches they contain by the
+   * block pickup/drop and cache creation/removal events.
+   *
    * @param pos The position of a robot.
    *
    * @return The ID of the block that the robot is on, or -1 if the robot is not
@@ -173,6 +182,9 @@ class arena_map : public rcppsw::er::client,
    * robot. This happens during initialization when the robot's sensors have not
    * yet been properly initialized by ARGoS.
    *
+   * As with \ref robot_on_block(), only nearby cells are searched, and the
+   * index of a cache found in one is looked up in O(1).
+   *
    * @param pos The position of a robot.
    *
    * @return The ID of the cache that the robot is on, or -1 if the robot is not
@@ -187,23 +199,98 @@ class arena_map : public rcppsw::er::client,
    * @param y Y coord of the center of the subgrid.
    * @param radius The radius of the subgrid.
    *
+   * The part of the grid the subgrid covers must have been allocated via \ref
+   * subgrid_allocate() first.
+   *
    * @return The subgrid.
    */
-  rcppsw::ds::grid_view<cell2D*> subgrid(size_t x, size_t y, size_t radius) {
+  arena_grid_view subgrid(size_t x, size_t y, size_t radius) const {
     return m_grid.subcircle(x, y, radius);
   }
-  double grid_resolution(void) { return m_grid.resolution(); }
+
+  /**
+   * @brief Allocate the part of the grid covered by \ref subgrid() for the
+   * same arguments, so that getting the subgrid only reads the arena.
+   */
+  void subgrid_allocate(size_t x, size_t y, size_t radius) {
+    m_grid.subcircle_allocate(x, y, radius);
+  }
+
+  /**
+   * @brief Get the arena grid, for reading (i.e. re-targeting a LOS in place).
+   */
+  const arena_grid& grid(void) const { return m_grid; }
+  double grid_resolution(void) const { return m_grid.resolution(); }
+
+  /**
+   * @brief Get the color of the arena floor at the specified point: the nest,
+   * a cache, a block, or nothing, in that order of precedence.
+   *
+   * Cells of a single color are painted into the floor raster the first time
+   * they are queried, so this is usually a single lookup. Points in cells near
+   * blocks/caches or the edge of the nest are computed from the nearby cells.
+   */
+  argos::CColor floor_color(const argos::CVector2& pos);
+
+  /**
+   * @brief Notify the arena map that the block/cache the specified cell
+   * contains has changed, so that the floor raster around it is unpainted,
+   * and the cell is marked as free/occupied for block distribution.
+   */
+  void cell_changed(const rcppsw::math::dcoord2& d);
 
  private:
+  /**
+   * @brief Unpaint the cells of the floor raster whose colors can depend on
+   * the specified cell.
+   */
+  void floor_invalidate(const rcppsw::math::dcoord2& d);
+
+  /**
+   * @brief Re-build the map from caches to their index in \ref caches(), after
+   * caches have been created or removed.
+   */
+  void cache_index_rebuild(void);
+
+  /**
+   * @brief Re-synchronize which cells are free for block distribution with the
+   * grid, after many cells may have changed at once.
+   */
+  void free_cells_rebuild(void);
+
+  /**
+   * @brief Compute the range of discrete cells within the specified # of cells
+   * of a real location (clamped to the arena), as [xmin, xmax] x [ymin, ymax].
+   */
+  std::pair<rcppsw::math::dcoord2, rcppsw::math::dcoord2> search_range(
+      const argos::CVector2& pos,
+      size_t radius) const;
+
+  /**
+   * @brief Determine if every point that discretizes to the specified cell has
+   * the same floor color, and if so, what it is.
+   */
+  bool floor_cell_uniform(const rcppsw::math::dcoord2& d,
+                          argos::CColor* color) const;
+  argos::CColor floor_color_calc(const argos::CVector2& pos) const;
+
+  using cache_index_map = std::unordered_map<const arena_cache*, size_t>;
+
   // clang-format off
   bool                                      m_cache_removed;
+  size_t                                    m_block_search_radius;
+  size_t                                    m_cache_search_radius;
   const struct params::depth1::cache_params mc_cache_params;
   const argos::CVector2                     mc_nest_center;
+  const argos::CRange<double>               mc_nest_xrange;
+  const argos::CRange<double>               mc_nest_yrange;
   block_vector                              m_blocks;
   cache_vector                              m_caches;
+  cache_index_map                           m_cache_index;
   support::block_distributor                m_block_distributor;
   std::shared_ptr<rcppsw::er::server>       m_server;
   arena_grid                                m_grid;
+  floor_raster                              m_floor;
   // clang-format on
 };
 
@@ -106,6 +106,7 @@ class base_cache : public immovable_cell_entity,
    */
   void block_add(const std::shared_ptr<block>& block) {
     m_blocks.push_back(block);
+    version_bump();
   }
 
   /**
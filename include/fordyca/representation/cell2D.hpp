@@ -24,7 +24,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <string>
+#include <cstdint>
+#include <memory>
 
 #include "fordyca/fsm/cell2D_fsm.hpp"
 #include "rcppsw/math/dcoord.hpp"
@@ -33,9 +34,6 @@
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
-namespace rcppsw { namespace er {
-class server;
-}} // namespace rcppsw::er
 NS_START(fordyca, representation);
 
 namespace visitor = rcppsw::patterns::visitor;
@@ -52,18 +50,21 @@ class cell_entity;
  *
  * @brief Base representation of a cell on a 2D grid. A combination of FSM +
  * handle to whatever \ref cell_entity the cell contains, if any.
+ *
+ * Every robot has a grid of these, so cells are kept as small as possible:
+ * the handle to the entity is non-owning (entities are owned by the \ref
+ * arena_map/\ref perceived_arena_map the grid belongs to), and anything that
+ * is the same for all cells in a grid (i.e. the robot ID) lives in the
+ * grid. Illegal transitions of the cell FSM are reported by the event that
+ * drove them.
  */
 class cell2D : public visitor::visitable_any<cell2D> {
  public:
-  explicit cell2D(const std::shared_ptr<rcppsw::er::server>& server);
-  cell2D(void);
+  cell2D(void) : m_entity(nullptr), m_x(0), m_y(0), m_fsm() {}
 
   cell2D(const cell2D& other) = default;
   cell2D& operator=(const cell2D& other) = delete;
 
-  void robot_id(const std::string& robot_id) { m_robot_id = robot_id; }
-  const std::string& robot_id(void) const { return m_robot_id; }
-
   /* state inquiry */
 
   /**
@@ -94,12 +95,20 @@ class cell2D : public visitor::visitable_any<cell2D> {
   size_t block_count(void) const { return m_fsm.block_count(); }
 
   /**
-   * @brief Set the entity associated with this cell.
+   * @brief Set the entity associated with this cell. The cell does not take
+   * ownership of the entity.
    */
-  void entity(const std::shared_ptr<cell_entity>& entity) { m_entity = entity; }
-  const std::shared_ptr<cell_entity>& entity(void) const { return m_entity; }
-  void loc(rcppsw::math::dcoord2 loc) { m_loc = loc; }
-  rcppsw::math::dcoord2 loc(void) const { return m_loc; }
+  void entity(const std::shared_ptr<cell_entity>& entity) {
+    m_entity = entity.get();
+  }
+  cell_entity* entity(void) const { return m_entity; }
+  void loc(rcppsw::math::dcoord2 loc) {
+    m_x = static_cast<uint32_t>(loc.first);
+    m_y = static_cast<uint32_t>(loc.second);
+  }
+  rcppsw::math::dcoord2 loc(void) const {
+    return rcppsw::math::dcoord2(m_x, m_y);
+  }
 
   /**
    * @brief Get the block entity associated with this cell.
@@ -123,10 +132,10 @@ class cell2D : public visitor::visitable_any<cell2D> {
 
  private:
   // clang-format off
-  std::string                  m_robot_id{""};
-  std::shared_ptr<cell_entity> m_entity{nullptr};
-  rcppsw::math::dcoord2        m_loc;
-  fsm::cell2D_fsm              m_fsm;
+  cell_entity*    m_entity;
+  uint32_t        m_x;
+  uint32_t        m_y;
+  fsm::cell2D_fsm m_fsm;
   // clang-format on
 };
 
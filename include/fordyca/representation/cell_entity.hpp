@@ -26,6 +26,7 @@
  ******************************************************************************/
 #include <argos3/core/utility/datatypes/color.h>
 #include <argos3/core/utility/math/vector2.h>
+#include <memory>
 #include <utility>
 #include "rcppsw/common/common.hpp"
 #include "rcppsw/math/dcoord.hpp"
@@ -44,8 +45,12 @@ NS_START(fordyca, representation);
  *
  * @brief A base class from which objects that are able to occupy a cell within
  * a 2D grid derive.
+ *
+ * Cell entities must be owned by a \c std::shared_ptr, as cells only hold a
+ * raw handle to the entity they contain, and get a shared handle back via
+ * \c shared_from_this().
  */
-class cell_entity {
+class cell_entity : public std::enable_shared_from_this<cell_entity> {
  public:
   cell_entity(double x_dim, double y_dim, argos::CColor color)
       : cell_entity{x_dim, y_dim, color, -1} {}
@@ -104,11 +109,22 @@ class cell_entity {
     return m_discrete_loc;
   }
 
-  virtual void real_loc(const argos::CVector2& loc) { m_real_loc = loc; }
+  virtual void real_loc(const argos::CVector2& loc) {
+    m_real_loc = loc;
+    version_bump();
+  }
   virtual void discrete_loc(const rcppsw::math::dcoord2& loc) {
     m_discrete_loc = loc;
+    version_bump();
   }
 
+  /**
+   * @brief Get the version of the entity, which changes every time the
+   * location or contents of the entity change. Used to detect which entities
+   * within a robot's LOS have changed since the last timestep.
+   */
+  uint version(void) const { return m_version; }
+
   /**
    * @brief Determine if a real-valued point lies within the extent of the
    * entity
@@ -138,6 +154,9 @@ class cell_entity {
    */
   const argos::CColor& color(void) const { return m_color; }
 
+ protected:
+  void version_bump(void) { ++m_version; }
+
  private:
   // clang-format off
   int                   m_id;
@@ -147,6 +166,7 @@ class cell_entity {
   argos::CColor         m_color;
   argos::CVector2       m_real_loc;
   rcppsw::math::dcoord2 m_discrete_loc;
+  uint                  m_version{0};
   // clang-format on
 };
 
@@ -0,0 +1,170 @@
+/**
+ * @file entity_store.hpp
+ * @ingroup representation
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_REPRESENTATION_ENTITY_STORE_HPP_
+#define INCLUDE_FORDYCA_REPRESENTATION_ENTITY_STORE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "rcppsw/common/common.hpp"
+#include "rcppsw/math/dcoord.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, representation);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class entity_store
+ * @ingroup representation
+ *
+ * @brief A collection of cell entities (blocks or caches), indexed by both ID
+ * and discrete location, so that adding, moving, and removing entities are
+ * O(1) operations.
+ *
+ * Entities are stored in insertion order, which is preserved across removals,
+ * so that anything iterating over the store (i.e. the block/cache selectors)
+ * is deterministic.
+ *
+ * If more than one entity is added with the same ID/location, the index refers
+ * to the most recently added one; it is up to the caller to remove stale
+ * entities first. The location of an entity must not change while it is in
+ * the store (remove it, and then add it again).
+ */
+template <typename T>
+class entity_store {
+ public:
+  using entity_list = std::list<std::shared_ptr<T>>;
+  using iterator = typename entity_list::iterator;
+  using const_iterator = typename entity_list::const_iterator;
+
+  entity_store(void) : m_entities(), m_by_id(), m_by_loc() {}
+
+  const entity_list& entities(void) const { return m_entities; }
+  const_iterator begin(void) const { return m_entities.begin(); }
+  const_iterator end(void) const { return m_entities.end(); }
+  size_t size(void) const { return m_entities.size(); }
+  bool empty(void) const { return m_entities.empty(); }
+
+  /**
+   * @brief Get the entity with the specified ID, or NULL if no such entity
+   * exists.
+   */
+  std::shared_ptr<T> find_by_id(int id) const {
+    auto it = m_by_id.find(id);
+    return (m_by_id.end() == it) ? nullptr : *(it->second);
+  }
+
+  /**
+   * @brief Get the entity at the specified discrete location, or NULL if no
+   * such entity exists.
+   */
+  std::shared_ptr<T> find_by_loc(const rcppsw::math::dcoord2& loc) const {
+    auto it = m_by_loc.find(loc);
+    return (m_by_loc.end() == it) ? nullptr : *(it->second);
+  }
+
+  /**
+   * @brief Add an entity to the end of the store.
+   */
+  void add(const std::shared_ptr<T>& ent) {
+    auto it = m_entities.insert(m_entities.end(), ent);
+    m_by_id[ent->id()] = it;
+    m_by_loc[ent->discrete_loc()] = it;
+  }
+
+  /**
+   * @brief Remove the entity with the specified ID.
+   *
+   * @return \c TRUE iff an entity was removed.
+   */
+  bool remove_by_id(int id) {
+    auto it = m_by_id.find(id);
+    if (m_by_id.end() == it) {
+      return false;
+    }
+    erase(it->second);
+    return true;
+  }
+
+  /**
+   * @brief Remove the entity at the specified discrete location.
+   *
+   * @return \c TRUE iff an entity was removed.
+   */
+  bool remove_by_loc(const rcppsw::math::dcoord2& loc) {
+    auto it = m_by_loc.find(loc);
+    if (m_by_loc.end() == it) {
+      return false;
+    }
+    erase(it->second);
+    return true;
+  }
+
+  void clear(void) {
+    m_entities.clear();
+    m_by_id.clear();
+    m_by_loc.clear();
+  }
+
+ private:
+  struct dcoord2_hash {
+    size_t operator()(const rcppsw::math::dcoord2& d) const {
+      return std::hash<size_t>()(d.first) ^
+             (std::hash<size_t>()(d.second) << 1);
+    }
+  };
+
+  void erase(iterator it) {
+    auto id_it = m_by_id.find((*it)->id());
+    if (m_by_id.end() != id_it && id_it->second == it) {
+      m_by_id.erase(id_it);
+    }
+    auto loc_it = m_by_loc.find((*it)->discrete_loc());
+    if (m_by_loc.end() != loc_it && loc_it->second == it) {
+      m_by_loc.erase(loc_it);
+    }
+    m_entities.erase(it);
+  }
+
+  using id_index = std::unordered_map<int, iterator>;
+  using loc_index =
+      std::unordered_map<rcppsw::math::dcoord2, iterator, dcoord2_hash>;
+
+  // clang-format off
+  entity_list m_entities;
+  id_index    m_by_id;
+  loc_index   m_by_loc;
+  // clang-format on
+};
+
+NS_END(representation, fordyca);
+
+#endif /* INCLUDE_FORDYCA_REPRESENTATION_ENTITY_STORE_HPP_ */
@@ -0,0 +1,151 @@
+/**
+ * @file floor_raster.hpp
+ * @ingroup representation
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_REPRESENTATION_FLOOR_RASTER_HPP_
+#define INCLUDE_FORDYCA_REPRESENTATION_FLOOR_RASTER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <argos3/core/utility/datatypes/color.h>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "fordyca/representation/tiled_grid.hpp"
+#include "rcppsw/common/common.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, representation);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class floor_raster
+ * @ingroup representation
+ *
+ * @brief A cache of the colors of the arena floor, with one entry per arena
+ * grid cell, so that querying the color of a point on the floor is usually a
+ * single lookup.
+ *
+ * An entry is either unpainted, the single color of every point in the cell,
+ * or marks the cell as having more than one color (i.e. the cell is near a
+ * block/cache or the edge of the nest), in which case the color of each point
+ * has to be computed when it is queried. Entries are painted the first time
+ * their cell is queried, and unpainted again when the contents of the arena
+ * around them change.
+ *
+ * Entries are stored as indices into a small palette, in tiles that are only
+ * allocated once a cell in them has been painted, so memory only grows with
+ * the parts of the floor that have been queried, and unpainting the whole
+ * floor is O(# tiles).
+ */
+class floor_raster {
+ public:
+  floor_raster(size_t xdsize, size_t ydsize)
+      : m_cells(xdsize, ydsize), m_palette() {}
+
+  /**
+   * @brief Get the single color of every point in a cell.
+   *
+   * @return The color, or NULL if the cell has not been painted since it was
+   * last invalidated, or has more than one color.
+   */
+  const argos::CColor* color(size_t i, size_t j) const {
+    uint8_t entry = m_cells.access(i, j);
+    return (entry >= kPALETTE_START) ? &m_palette[entry - kPALETTE_START]
+                                     : nullptr;
+  }
+
+  /**
+   * @brief Has a cell been painted with more than one color since it was last
+   * invalidated?
+   */
+  bool mixed(size_t i, size_t j) const {
+    return kMIXED == m_cells.access(i, j);
+  }
+
+  /**
+   * @brief Paint a cell with a single color. If the palette is full, the cell
+   * is painted as mixed instead, so its points are computed when queried.
+   */
+  void paint(size_t i, size_t j, const argos::CColor& color) {
+    m_cells.access(i, j) = palette_index(color);
+  }
+
+  /**
+   * @brief Paint a cell as having more than one color.
+   */
+  void paint_mixed(size_t i, size_t j) { m_cells.access(i, j) = kMIXED; }
+
+  /**
+   * @brief Unpaint the cells in [ilow, ihigh] x [jlow, jhigh] (clamped to the
+   * raster). Never allocates.
+   */
+  void invalidate(size_t ilow, size_t jlow, size_t ihigh, size_t jhigh) {
+    ihigh = std::min(ihigh, m_cells.xdsize() - 1);
+    jhigh = std::min(jhigh, m_cells.ydsize() - 1);
+    for (size_t i = ilow; i <= ihigh; ++i) {
+      for (size_t j = jlow; j <= jhigh; ++j) {
+        if (m_cells.allocated(i, j)) {
+          m_cells.access(i, j) = kUNPAINTED;
+        }
+      } /* for(j..) */
+    }   /* for(i..) */
+  }
+
+  /**
+   * @brief Unpaint all cells, freeing all tiles.
+   */
+  void invalidate_all(void) {
+    m_cells = tiled_grid<uint8_t>(m_cells.xdsize(), m_cells.ydsize());
+  }
+
+ private:
+  static constexpr uint8_t kUNPAINTED = 0;
+  static constexpr uint8_t kMIXED = 1;
+  static constexpr uint8_t kPALETTE_START = 2;
+  static constexpr size_t kMAX_COLORS = 256 - kPALETTE_START;
+
+  uint8_t palette_index(const argos::CColor& color) {
+    auto it = std::find(m_palette.begin(), m_palette.end(), color);
+    if (it == m_palette.end()) {
+      if (m_palette.size() >= kMAX_COLORS) {
+        return kMIXED;
+      }
+      it = m_palette.insert(m_palette.end(), color);
+    }
+    return static_cast<uint8_t>(kPALETTE_START +
+                                std::distance(m_palette.begin(), it));
+  }
+
+  // clang-format off
+  tiled_grid<uint8_t>        m_cells;
+  std::vector<argos::CColor> m_palette;
+  // clang-format on
+};
+
+NS_END(representation, fordyca);
+
+#endif /* INCLUDE_FORDYCA_REPRESENTATION_FLOOR_RASTER_HPP_ */
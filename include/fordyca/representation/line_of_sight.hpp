@@ -24,10 +24,10 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <boost/multi_array.hpp>
-#include <list>
+#include <boost/optional.hpp>
 #include <utility>
-#include "rcppsw/ds/grid2D_ptr.hpp"
+#include <vector>
+#include "fordyca/representation/arena_grid.hpp"
 #include "rcppsw/math/dcoord.hpp"
 
 /*******************************************************************************
@@ -37,6 +37,37 @@ NS_START(fordyca, representation);
 class block;
 class base_cache;
 class cell2D;
+class cell_entity;
+
+/*******************************************************************************
+ * Struct Definitions
+ ******************************************************************************/
+/**
+ * @struct los_delta
+ * @ingroup representation
+ *
+ * @brief The changes to a robot's LOS since the last time it was processed.
+ *
+ * Coordinates in \ref entered, \ref changed, and \ref unchanged are relative
+ * to the current LOS; coordinates in \ref left are absolute, as those cells
+ * are no longer in the LOS.
+ */
+struct los_delta {
+  /** Cells that are in the LOS now, but were not last time. */
+  std::vector<rcppsw::math::dcoord2> entered;
+
+  /** Cells that were in the LOS last time, but are not now. */
+  std::vector<rcppsw::math::dcoord2> left;
+
+  /** Cells in the LOS both times whose contents changed in between. */
+  std::vector<rcppsw::math::dcoord2> changed;
+
+  /**
+   * Cells in the LOS both times that contain the same, unmodified block/cache
+   * (empty cells that stayed empty are not included).
+   */
+  std::vector<rcppsw::math::dcoord2> unchanged;
+};
 
 /*******************************************************************************
  * Class Definitions
@@ -55,20 +86,83 @@ class cell2D;
  *
  * All coordinates within a LOS are relative to the LOS itself (not its location
  * within the arena). The origin is in the lower left corner of the LOS.
+ *
+ * A LOS is meant to be long-lived: each robot owns a single one, which is
+ * re-targeted to a new region of the arena each timestep via \ref retarget().
+ * The block/cache buffers returned by \ref blocks() and \ref caches() are
+ * re-filled in place, so once they have grown to the largest number of
+ * entities a robot has seen, querying the LOS does not allocate.
+ *
+ * The LOS also tracks what the cells it covered looked like the last time it
+ * was processed, so that robots only need to fully process the parts of their
+ * LOS that actually changed (see \ref delta()).
  */
 class line_of_sight {
  public:
-  using block_list = std::list<std::shared_ptr<block>>;
-  using const_block_list = std::list<std::shared_ptr<const block>>;
-  using cache_list = std::list<std::shared_ptr<base_cache>>;
-  using const_cache_list = std::list<std::shared_ptr<const base_cache>>;
+  using const_block_vector = std::vector<std::shared_ptr<const block>>;
+  using const_cache_vector = std::vector<std::shared_ptr<const base_cache>>;
 
-  line_of_sight(const rcppsw::ds::grid_view<cell2D*>& c_view,
+  /**
+   * @brief Create an un-targeted LOS; \ref retarget() must be called before
+   * it is used.
+   */
+  line_of_sight(void)
+      : m_center(),
+        m_view(),
+        m_blocks(),
+        m_caches(),
+        m_extra_caches(),
+        m_delta(),
+        m_sigs(),
+        m_next_sigs() {}
+
+  line_of_sight(const arena_grid_view& c_view,
                 rcppsw::math::dcoord2 center)
-      : m_center(std::move(center)), m_view(c_view), m_caches() {}
+      : line_of_sight() {
+    retarget(c_view, center);
+  }
+
+  line_of_sight(const line_of_sight& other) = delete;
+  line_of_sight& operator=(const line_of_sight& other) = delete;
+
+  /**
+   * @brief Move the LOS to a new region of the arena, discarding any caches
+   * added via \ref cache_add() for the previous region.
+   */
+  void retarget(const arena_grid_view& c_view,
+                const rcppsw::math::dcoord2& center);
+
+  /**
+   * @brief As \ref retarget(), but for the region of the grid within \c
+   * radius cells of \c center (see \ref arena_grid::subcircle()), which is
+   * filled into the existing view in place, so that it does not allocate once
+   * the view has grown to the size of a full LOS.
+   */
+  void retarget(const arena_grid& grid,
+                const rcppsw::math::dcoord2& center,
+                size_t radius);
+
+  /**
+   * @brief Has the LOS been targeted at a region of the arena yet?
+   */
+  bool targeted(void) const { return static_cast<bool>(m_view); }
 
-  const_block_list blocks(void) const;
-  const_cache_list caches(void) const;
+  /**
+   * @brief Get the blocks currently in the LOS.
+   *
+   * The returned reference is to a buffer owned by the LOS, and is only valid
+   * until the next call to this function or to \ref retarget().
+   */
+  const const_block_vector& blocks(void) const;
+
+  /**
+   * @brief Get the caches currently in the LOS (including those added via
+   * \ref cache_add()).
+   *
+   * The returned reference is to a buffer owned by the LOS, and is only valid
+   * until the next call to this function or to \ref retarget().
+   */
+  const const_cache_vector& caches(void) const;
 
   /**
    * @brief Add a cache to the LOS, beyond those whose host cell currently falls
@@ -76,12 +170,29 @@ class line_of_sight {
    */
   void cache_add(const std::shared_ptr<base_cache>& cache);
 
+  /**
+   * @brief Get the caches added via \ref cache_add() since the last
+   * re-target, whose host cells are not in the LOS.
+   */
+  const const_cache_vector& extra_caches(void) const { return m_extra_caches; }
+
+  /**
+   * @brief Get the changes to the LOS since the last time it was processed.
+   *
+   * The delta is computed the first time this function is called after a
+   * re-target, against the state of the LOS cells at that point, and is then
+   * fixed until the next re-target. Blocks/caches are compared by their \ref
+   * cell_entity::version(), so cells whose entity moved or had blocks
+   * added/removed are reported as changed.
+   */
+  const los_delta& delta(void) const;
+
   /**
    * @brief Get the size of the X dimension for a LOS.
    *
    * @return The X dimension.
    */
-  size_t xsize(void) const { return m_view.shape()[0]; }
+  size_t xsize(void) const { return m_view->xsize(); }
 
   rcppsw::math::dcoord2 abs_ll(void) const;
   rcppsw::math::dcoord2 abs_lr(void) const;
@@ -93,14 +204,14 @@ class line_of_sight {
    *
    * @return The Y dimension.
    */
-  size_t ysize(void) const { return m_view.shape()[1]; }
+  size_t ysize(void) const { return m_view->ysize(); }
 
   /**
    * @brief Get the # elements in a LOS.
    *
    * @return # elements.
    */
-  size_t size(void) const { return m_view.num_elements(); }
+  size_t size(void) const { return m_view->size(); }
 
   /**
    * @brief Get the cell associated with a particular grid location within the
@@ -112,7 +223,7 @@ class line_of_sight {
    *
    * @return A reference to the cell.
    */
-  cell2D& cell(size_t i, size_t j) const;
+  const cell2D& cell(size_t i, size_t j) const;
 
   /**
    * @brief Get the coordinates for the center of the LOS.
@@ -122,10 +233,61 @@ class line_of_sight {
   const rcppsw::math::dcoord2& center(void) const { return m_center; }
 
  private:
+  /**
+   * @brief Is the host cell of the specified cache within the LOS?
+   */
+  bool cache_in_view(const std::shared_ptr<base_cache>& cache) const;
+
+  /**
+   * @brief What a LOS cell looked like the last time the LOS was processed.
+   */
+  struct cell_sig {
+    const cell_entity* entity;
+    int id;
+    uint version;
+    size_t block_count;
+    bool operator==(const cell_sig& other) const {
+      return entity == other.entity && id == other.id &&
+             version == other.version && block_count == other.block_count;
+    }
+  };
+
+  /**
+   * @brief The region of the arena covered by the signatures in \ref m_sigs.
+   */
+  struct sig_region {
+    bool valid;
+    rcppsw::math::dcoord2 ll;
+    size_t xsize;
+    size_t ysize;
+    bool contains(const rcppsw::math::dcoord2& d) const {
+      return valid && d.first >= ll.first && d.second >= ll.second &&
+             d.first - ll.first < xsize && d.second - ll.second < ysize;
+    }
+    size_t index(const rcppsw::math::dcoord2& d) const {
+      return (d.first - ll.first) * ysize + (d.second - ll.second);
+    }
+  };
+
+  static cell_sig cell_sig_calc(const cell2D& cell);
+  void retarget_reset(const rcppsw::math::dcoord2& center);
+  void delta_calc(void) const;
+
+  /*
+   * The view is empty until the first retarget, and is re-filled (rather
+   * than re-constructed) on subsequent ones, so that its buffer is re-used.
+   */
   // clang-format off
-  rcppsw::math::dcoord2          m_center;
-  rcppsw::ds::grid_view<cell2D*> m_view;
-  const_cache_list               m_caches;
+  rcppsw::math::dcoord2                            m_center;
+  boost::optional<arena_grid_view>                 m_view;
+  mutable const_block_vector                       m_blocks;
+  mutable const_cache_vector                       m_caches;
+  const_cache_vector                               m_extra_caches;
+  mutable bool                                     m_delta_valid{false};
+  mutable los_delta                                m_delta;
+  mutable sig_region                               m_sig_region{};
+  mutable std::vector<cell_sig>                    m_sigs;
+  mutable std::vector<cell_sig>                    m_next_sigs;
   // clang-format on
 };
 
@@ -25,11 +25,15 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <functional>
+#include <queue>
 #include <string>
 #include <tuple>
+#include <vector>
 
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/representation/cell2D.hpp"
-#include "rcppsw/ds/stacked_grid.hpp"
+#include "fordyca/representation/tiled_grid.hpp"
 #include "rcppsw/math/dcoord.hpp"
 #include "rcppsw/swarm/pheromone_density.hpp"
 
@@ -49,32 +53,179 @@ NS_START(representation);
  ******************************************************************************/
 using layer_stack = std::tuple<rcppsw::swarm::pheromone_density, cell2D>;
 
-class occupancy_grid : public rcppsw::er::client,
-                       public rcppsw::ds::stacked_grid2<layer_stack> {
+/**
+ * @class occupancy_grid
+ * @ingroup representation
+ *
+ * @brief A robot's discretized view of the arena: the pheromone density and
+ * the \ref cell2D for each cell, accessed as layers via \ref access().
+ *
+ * The grid is stored as tiles which are allocated the first time they are
+ * written to (see \ref tiled_grid), so a robot only uses memory for the parts
+ * of the arena it has actually seen. If the \c shared_baseline parameter is
+ * set, all grids with the same dimensions start out as copy-on-write copies of
+ * a single baseline grid, and copy each tile they allocate from the baseline's
+ * blank tile for that position instead of initializing it themselves.
+ */
+class occupancy_grid : public rcppsw::er::client {
  public:
+  template <int Index>
+  using layer_value_type =
+      typename std::tuple_element<Index, layer_stack>::type;
+
   occupancy_grid(std::shared_ptr<rcppsw::er::server> server,
                  const struct params::depth0::occupancy_grid_params* c_params,
                  const std::string& robot_id);
 
   /**
-   * @brief Update the density of all cells in the grid.
+   * @brief Update the density of cells in the grid.
+   *
+   * If lazy decay is disabled, the density of all known cells is
+   * updated. Otherwise, only the cells that received a deposit this timestep
+   * are updated, and the cells whose density has fallen below the relevance
+   * threshold as of this timestep are transitioned to UNKNOWN.
+   *
+   * @param timestep The current timestep.
+   */
+  void update(uint timestep);
+
+  /**
+   * @brief Get a reference to the density of a cell in order to modify it
+   * (i.e. make a pheromone deposit).
+   *
+   * If lazy decay is enabled, the density is first brought up to date with the
+   * last timestep the grid was updated, and the cell is scheduled for update
+   * during the next call to \ref update().
+   */
+  rcppsw::swarm::pheromone_density& density(size_t i, size_t j);
+
+  /**
+   * @brief Get the current density of a cell, for reading. If lazy decay is
+   * enabled, the density is computed in closed form from the value at the time
+   * of the last deposit.
+   */
+  rcppsw::swarm::pheromone_density density_current(
+      const rcppsw::math::dcoord2& d) const;
+
+  /**
+   * @brief Add a cell to the set of known cells (i.e. cells that contain a
+   * block/cache, or that did until recently), whose relevance must be
+   * tracked. Adding a cell that is already known is a no-op.
+   *
+   * Cells are removed from the set when their relevance expires and they
+   * transition to UNKNOWN.
    */
-  void update(void);
+  void known_cell_add(size_t i, size_t j);
+
+  /**
+   * @brief Get the indices (i * ydsize() + j) of all cells currently in the
+   * known set. Order is deterministic, but not stable across removals.
+   */
+  const std::vector<size_t>& known_cells(void) const { return m_known_cells; }
+
   bool pheromone_repeat_deposit(void) const {
     return m_pheromone_repeat_deposit;
   }
+  bool lazy_decay(void) const { return m_lazy_decay; }
   constexpr static uint kPheromoneLayer = 0;
   constexpr static uint kCellLayer = 1;
 
+  /**
+   * @brief Access a layer of a cell for writing. If the part of the grid
+   * containing the cell has not been allocated yet, it is allocated, and if it
+   * is shared with other grids, it is copied first.
+   */
+  template <int Index>
+  layer_value_type<Index>& access(size_t i, size_t j) {
+    return std::get<Index>(m_cells.access(i, j).layers);
+  }
+  template <int Index>
+  const layer_value_type<Index>& access(size_t i, size_t j) const {
+    return std::get<Index>(m_cells.access(i, j).layers);
+  }
+  template <int Index>
+  layer_value_type<Index>& access(const rcppsw::math::dcoord2& d) {
+    return access<Index>(d.first, d.second);
+  }
+  template <int Index>
+  const layer_value_type<Index>& access(const rcppsw::math::dcoord2& d) const {
+    return access<Index>(d.first, d.second);
+  }
+
+  size_t xdsize(void) const { return m_cells.xdsize(); }
+  size_t ydsize(void) const { return m_cells.ydsize(); }
+  double resolution(void) const { return m_resolution; }
+
  private:
-  void cell_update(size_t i, size_t j);
-  void cell_init(size_t i, size_t j, double pheromone_rho);
+  static constexpr uint32_t kNotKnown{static_cast<uint32_t>(-1)};
+
+  /**
+   * @brief A cell's layers, along with the grid's per-cell bookkeeping for
+   * known cells and lazy decay, so that it is only allocated for the parts of
+   * the grid that are actually used.
+   */
+  struct grid_cell {
+    layer_stack layers{};
+    uint deposit_ts{0};
+    uint32_t known_pos{kNotKnown};
+    uint8_t touched{0};
+  };
+  using cell_grid = tiled_grid<grid_cell>;
+
+  /**
+   * @brief An entry in the expiry queue for lazy decay: the timestep at which
+   * the density of the cell at the specified index will fall below \ref
+   * kEpsilon, given the deposit made at the specified timestep. Entries whose
+   * deposit timestep does not match that of the cell are stale and ignored.
+   */
+  struct expiry_entry {
+    uint expiry;
+    uint deposit_ts;
+    size_t index;
+    bool operator>(const expiry_entry& other) const {
+      return expiry > other.expiry;
+    }
+  };
+  using expiry_queue = std::priority_queue<expiry_entry,
+                                           std::vector<expiry_entry>,
+                                           std::greater<expiry_entry>>;
+
+  static cell_grid grid_init(
+      const struct params::depth0::occupancy_grid_params* c_params);
+  static cell_grid grid_build(size_t xdsize,
+                              size_t ydsize,
+                              double pheromone_rho);
+  static const cell_grid& baseline_grid(size_t xdsize,
+                                        size_t ydsize,
+                                        double pheromone_rho);
+
+  bool cell_update(size_t i, size_t j);
+  void known_cell_remove(size_t index);
+  void lazy_update(uint timestep);
+  void lazy_cell_update(size_t index, uint timestep);
+  void cell_expire(size_t index);
+  double lazy_density_value(size_t index) const;
+  size_t cell_index(size_t i, size_t j) const { return i * ydsize() + j; }
+  grid_cell& cell_at(size_t index) {
+    return m_cells.access(index / ydsize(), index % ydsize());
+  }
+  const grid_cell& cell_at(size_t index) const {
+    return m_cells.access(index / ydsize(), index % ydsize());
+  }
 
   // clang-format off
+  static constexpr double             kEpsilon{0.0001};
   bool                                m_pheromone_repeat_deposit;
+  bool                                m_lazy_decay;
+  double                              m_pheromone_rho;
+  double                              m_resolution;
+  uint                                m_timestep{0};
   std::string                         m_robot_id;
-  static constexpr double             kEpsilon{0.0001};
   std::shared_ptr<rcppsw::er::server> m_server;
+  cell_grid                           m_cells;
+  std::vector<size_t>                 m_touched_cells;
+  expiry_queue                        m_expiry;
+  std::vector<size_t>                 m_known_cells;
   // clang-format on
 };
 
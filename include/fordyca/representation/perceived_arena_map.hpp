@@ -26,7 +26,9 @@
  ******************************************************************************/
 #include <list>
 #include <string>
+#include <vector>
 
+#include "fordyca/representation/entity_store.hpp"
 #include "fordyca/representation/occupancy_grid.hpp"
 #include "fordyca/representation/perceived_block.hpp"
 #include "fordyca/representation/perceived_cache.hpp"
@@ -64,8 +66,8 @@ class perceived_arena_map
     : public rcppsw::er::client,
       public rcppsw::patterns::visitor::visitable_any<perceived_arena_map> {
  public:
-  using cache_list = std::list<std::shared_ptr<base_cache>>;
-  using block_list = std::list<std::shared_ptr<block>>;
+  using cache_list = entity_store<base_cache>::entity_list;
+  using block_list = entity_store<block>::entity_list;
   using perceived_cache_list = std::list<perceived_cache>;
   using perceived_block_list = std::list<perceived_block>;
 
@@ -87,9 +89,10 @@ class perceived_arena_map
   perceived_block_list perceived_blocks(void) const;
 
   /**
-   * @brief Get a list of all blocks the robot is currently aware of.
+   * @brief Get a list of all blocks the robot is currently aware of, in the
+   * order they were added.
    */
-  block_list& blocks(void) { return m_blocks; }
+  const block_list& blocks(void) const { return m_blocks.entities(); }
 
   /**
    * @brief Get a list of all cache the robot is currently aware of and their
@@ -100,9 +103,10 @@ class perceived_arena_map
   perceived_cache_list perceived_caches(void) const;
 
   /**
-   * @brief Get a list of all caches the robot is currently aware of.
+   * @brief Get a list of all caches the robot is currently aware of, in the
+   * order they were added.
    */
-  cache_list& caches(void) { return m_caches; }
+  const cache_list& caches(void) const { return m_caches.entities(); }
 
   /**
    * @brief Add a cache to the list of perceived caches.
@@ -134,8 +138,9 @@ class perceived_arena_map
 
   /**
    * @brief Access a particular element in the discretized grid representing the
-   * robot's view of the arena. No bounds checking is performed, so if something
-   * is out of bounds, boost with fail with a bounds checking assertion.
+   * robot's view of the arena. No bounds checking is performed. Accessing a
+   * cell through a non-const map may copy the part of the grid containing it
+   * (see \ref occupancy_grid).
    *
    * @param i X coord.
    * @param j Y coord
@@ -143,31 +148,59 @@ class perceived_arena_map
    * @return The cell.
    */
   template <int Index>
-  typename occupancy_grid::layer_type<Index>::value_type& access(size_t i,
-                                                                 size_t j) {
+  occupancy_grid::layer_value_type<Index>& access(size_t i, size_t j) {
     return m_grid.access<Index>(i, j);
   }
   template <int Index>
-  const typename occupancy_grid::layer_type<Index>::value_type& access(
-      size_t i,
-      size_t j) const {
+  const occupancy_grid::layer_value_type<Index>& access(size_t i,
+                                                        size_t j) const {
     return m_grid.access<Index>(i, j);
   }
   template <int Index>
-  typename occupancy_grid::layer_type<Index>::value_type& access(
+  occupancy_grid::layer_value_type<Index>& access(
       const rcppsw::math::dcoord2& d) {
     return m_grid.access<Index>(d);
   }
   template <int Index>
-  const typename occupancy_grid::layer_type<Index>::value_type& access(
+  const occupancy_grid::layer_value_type<Index>& access(
       const rcppsw::math::dcoord2& d) const {
     return m_grid.access<Index>(d);
   }
 
   /**
-   * @brief Update the density of all cells in the perceived arena.
+   * @brief Get the density of a cell in the perceived arena in order to modify
+   * it. Pheromone deposits MUST go through this function rather than \ref
+   * access(), so that they are tracked correctly when lazy decay is enabled.
    */
-  void update(void) { m_grid.update(); }
+  rcppsw::swarm::pheromone_density& density(size_t i, size_t j) {
+    return m_grid.density(i, j);
+  }
+
+  /**
+   * @brief Refresh the relevance of the block/cache in a cell that the robot
+   * already knows about and is seeing again, unchanged.
+   */
+  void density_refresh(const rcppsw::math::dcoord2& d);
+
+  /**
+   * @brief Mark a cell as known, so that its relevance is tracked until it
+   * expires. Must be called whenever a block/cache is found in a cell.
+   */
+  void known_cell_add(size_t i, size_t j) { m_grid.known_cell_add(i, j); }
+
+  /**
+   * @brief Get the indices of all cells the robot currently knows about.
+   */
+  const std::vector<size_t>& known_cells(void) const {
+    return m_grid.known_cells();
+  }
+
+  /**
+   * @brief Update the density of cells in the perceived arena.
+   *
+   * @param timestep The current timestep.
+   */
+  void update(uint timestep) { m_grid.update(timestep); }
 
  private:
   // clang-format off
@@ -180,16 +213,18 @@ class perceived_arena_map
    * not stored with the cache, because that is a properly of the cell the cache
    * resides in, and not the cache itself. These are pointers, rather than a
    * contiguous array, to get better support from valgrind for debugging.
+   * Indexed by ID and location.
    */
-  cache_list m_caches;
+  entity_store<base_cache> m_caches;
 
   /**
    * @brief The blocks that the robot currently knows about. Their relevance is
    * not stored with the block, because that is a properly of the cell the block
    * resides in, and not the block itself.These are pointers, rather than a
    * contiguous array, to get better support from valgrind for debugging.
+   * Indexed by ID and location.
    */
-  block_list m_blocks;
+  entity_store<block> m_blocks;
 };
 
 NS_END(representation, fordyca);
@@ -0,0 +1,323 @@
+/**
+ * @file tiled_grid.hpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_REPRESENTATION_TILED_GRID_HPP_
+#define INCLUDE_FORDYCA_REPRESENTATION_TILED_GRID_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "rcppsw/common/common.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, representation);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class tiled_grid
+ * @ingroup representation
+ *
+ * @brief A 2D grid stored as square tiles of \ref kTILE_DIM x \ref kTILE_DIM
+ * elements, which are allocated on demand, and shared copy-on-write between
+ * copies of the grid.
+ *
+ * A tile is only allocated (and its elements initialized) the first time one of
+ * its elements is accessed for writing. Until then, reading any of its elements
+ * returns a single blank element, initialized the same way as the elements of
+ * new tiles, as element (0, 0). So a large grid of which only a small part is
+ * ever written to only uses memory for that part.
+ *
+ * Copying a grid only copies references to its tiles. A tile is copied the
+ * first time it is accessed for writing (i.e. via a non-const reference) by a
+ * grid that shares it, so many grids that start out as copies of one
+ * baseline only use memory for the parts in which they differ from it.
+ *
+ * Grids copied from one that shares its blank tiles (see \ref
+ * blank_tiles_share()) allocate tiles by copying a single initialized tile for
+ * each position, which is created the first time any of them allocates a tile
+ * there, rather than each initializing its own.
+ *
+ * A tile shared with other grids is never modified in place, so grids that
+ * share tiles can be used from different threads, as long as each grid is
+ * only used by one thread, and grids are only copied while no other thread is
+ * writing to them.
+ *
+ * @tparam T The type of the grid elements. Must be default constructible and
+ * copy constructible.
+ */
+template <typename T>
+class tiled_grid {
+ public:
+  static constexpr size_t kTILE_BITS = 5;
+  static constexpr size_t kTILE_DIM = 1U << kTILE_BITS;
+  using tile = std::array<T, kTILE_DIM * kTILE_DIM>;
+
+  /**
+   * @brief Function used to initialize each element (i, j) of a tile when it
+   * is allocated.
+   */
+  using elt_init = std::function<void(size_t, size_t, T&)>;
+
+  /**
+   * @brief Create a grid with no tiles allocated.
+   *
+   * @param init If non-empty, applied to each default constructed element of a
+   * tile when it is allocated.
+   */
+  tiled_grid(size_t xdsize, size_t ydsize, elt_init init = elt_init())
+      : m_xdsize(xdsize),
+        m_ydsize(ydsize),
+        m_xtiles((xdsize + kTILE_DIM - 1) >> kTILE_BITS),
+        m_ytiles((ydsize + kTILE_DIM - 1) >> kTILE_BITS),
+        m_init(std::move(init)),
+        m_blank(blank_create(m_init)),
+        m_blank_tiles(),
+        m_tiles(m_xtiles * m_ytiles) {}
+
+  tiled_grid(const tiled_grid& other) = default;
+  tiled_grid& operator=(const tiled_grid& other) = default;
+
+  size_t xdsize(void) const { return m_xdsize; }
+  size_t ydsize(void) const { return m_ydsize; }
+
+  /**
+   * @brief Get an element for reading. Never allocates or copies a tile.
+   *
+   * The reference reads this grid's element until the tile containing it is
+   * next accessed for writing through this grid, or this grid is assigned to.
+   * If the tile was unallocated or shared at that point, it is allocated or
+   * copied, and the reference is left reading the blank element or the tile
+   * still held by the other grids, which is freed once none of them do.
+   */
+  const T& access(size_t i, size_t j) const {
+    const std::shared_ptr<tile>& t = m_tiles[tile_index(i, j)];
+    return (t) ? (*t)[tile_offset(i, j)] : *m_blank;
+  }
+
+  /**
+   * @brief Get an element for writing, first allocating the tile that contains
+   * it if it has not been allocated yet, or copying it if it is shared with
+   * another grid.
+   *
+   * The reference must not be written through once this grid has been copied
+   * or assigned to another grid: the tile is shared again from then on, and
+   * the write would be seen by the other grid too. Call access() again to get
+   * a reference to this grid's own copy.
+   */
+  T& access(size_t i, size_t j) {
+    return (*tile_own(tile_index(i, j)))[tile_offset(i, j)];
+  }
+
+  /**
+   * @brief Allocate the tiles that have not been allocated yet and contain any
+   * of the elements in [ilow, ihigh) x [jlow, jhigh). Never copies a tile.
+   */
+  void allocate(size_t ilow, size_t jlow, size_t ihigh, size_t jhigh) {
+    if (ilow >= ihigh || jlow >= jhigh) {
+      return;
+    }
+    for (size_t ti = ilow >> kTILE_BITS; ti <= (ihigh - 1) >> kTILE_BITS;
+         ++ti) {
+      for (size_t tj = jlow >> kTILE_BITS; tj <= (jhigh - 1) >> kTILE_BITS;
+           ++tj) {
+        size_t index = ti * m_ytiles + tj;
+        if (!m_tiles[index]) {
+          m_tiles[index] = tile_create(index);
+        }
+      } /* for(tj..) */
+    }   /* for(ti..) */
+  }
+
+  /**
+   * @brief Allocate all tiles that have not been allocated yet.
+   */
+  void allocate_all(void) { allocate(0, 0, m_xdsize, m_ydsize); }
+
+  /**
+   * @brief Allocate tiles of this grid and all grids copied from it from now
+   * on as copies of shared blank tiles. Each blank tile is initialized the
+   * first time one of the grids allocates a tile in its position, and kept
+   * for as long as any of them exist. Creating a blank tile is thread safe.
+   */
+  void blank_tiles_share(void) {
+    if (!m_blank_tiles) {
+      m_blank_tiles = std::make_shared<blank_tiles>();
+      m_blank_tiles->tiles.resize(m_tiles.size());
+    }
+  }
+
+  /**
+   * @brief Has the tile containing the specified element been allocated?
+   */
+  bool allocated(size_t i, size_t j) const {
+    return static_cast<bool>(m_tiles[tile_index(i, j)]);
+  }
+
+  /**
+   * @brief Apply \c f(i, j, element) to each element of the allocated tiles,
+   * one tile at a time. The elements of unallocated tiles (which all read as
+   * the blank element) are skipped.
+   */
+  template <typename F>
+  void for_each_allocated(const F& f) const {
+    for (size_t index = 0; index < m_tiles.size(); ++index) {
+      if (m_tiles[index]) {
+        tile_visit(*m_tiles[index], index, f);
+      }
+    } /* for(index..) */
+  }
+
+  /**
+   * @brief As \ref for_each_allocated(), but for writing, so any visited tiles
+   * shared with another grid are copied first.
+   */
+  template <typename F>
+  void for_each_allocated(const F& f) {
+    for (size_t index = 0; index < m_tiles.size(); ++index) {
+      if (m_tiles[index]) {
+        tile_visit(*tile_own(index), index, f);
+      }
+    } /* for(index..) */
+  }
+
+  /**
+   * @brief Get the # of tiles that are not shared with any other grid.
+   */
+  size_t n_owned_tiles(void) const {
+    size_t n = 0;
+    for (auto& t : m_tiles) {
+      n += (1 == t.use_count());
+    } /* for(&t..) */
+    return n;
+  }
+  size_t n_tiles(void) const { return m_tiles.size(); }
+
+  /**
+   * @brief Get the # of tiles that have been allocated.
+   */
+  size_t n_allocated_tiles(void) const {
+    return static_cast<size_t>(std::count_if(
+        m_tiles.begin(), m_tiles.end(), [](const std::shared_ptr<tile>& t) {
+          return static_cast<bool>(t);
+        }));
+  }
+
+ private:
+  struct blank_tiles {
+    std::mutex mtx{};
+    std::vector<std::shared_ptr<const tile>> tiles{};
+  };
+
+  static std::shared_ptr<const T> blank_create(const elt_init& init) {
+    auto blank = std::make_shared<T>();
+    if (init) {
+      init(0, 0, *blank);
+    }
+    return blank;
+  }
+
+  size_t tile_index(size_t i, size_t j) const {
+    return (i >> kTILE_BITS) * m_ytiles + (j >> kTILE_BITS);
+  }
+  static size_t tile_offset(size_t i, size_t j) {
+    return ((i & (kTILE_DIM - 1)) << kTILE_BITS) | (j & (kTILE_DIM - 1));
+  }
+
+  /*
+   * A tile's reference count can only go up when a grid is copied, so a count
+   * of 1 means that no other grid can see the tile.
+   */
+  const std::shared_ptr<tile>& tile_own(size_t index) {
+    std::shared_ptr<tile>& t = m_tiles[index];
+    if (!t) {
+      t = tile_create(index);
+    } else if (t.use_count() > 1) {
+      t = std::make_shared<tile>(*t);
+    }
+    return t;
+  }
+
+  std::shared_ptr<tile> tile_create(size_t index) const {
+    if (m_blank_tiles) {
+      std::shared_ptr<const tile> blank;
+      {
+        std::lock_guard<std::mutex> lock(m_blank_tiles->mtx);
+        std::shared_ptr<const tile>& shared = m_blank_tiles->tiles[index];
+        if (!shared) {
+          shared = tile_init(index);
+        }
+        blank = shared;
+      }
+      return std::make_shared<tile>(*blank);
+    }
+    return tile_init(index);
+  }
+
+  std::shared_ptr<tile> tile_init(size_t index) const {
+    auto t = std::make_shared<tile>();
+    if (m_init) {
+      tile_visit(*t, index, m_init);
+    }
+    return t;
+  }
+
+  /*
+   * Visit the elements of a tile in storage order, skipping the padding of
+   * tiles on the upper edges of the grid.
+   */
+  template <typename Tile, typename F>
+  void tile_visit(Tile& t, size_t index, const F& f) const {
+    size_t ilow = (index / m_ytiles) << kTILE_BITS;
+    size_t jlow = (index % m_ytiles) << kTILE_BITS;
+    size_t ihigh = std::min(ilow + kTILE_DIM, m_xdsize);
+    size_t jhigh = std::min(jlow + kTILE_DIM, m_ydsize);
+    for (size_t i = ilow; i < ihigh; ++i) {
+      for (size_t j = jlow; j < jhigh; ++j) {
+        f(i, j, t[tile_offset(i, j)]);
+      } /* for(j..) */
+    }   /* for(i..) */
+  }
+
+  // clang-format off
+  size_t                             m_xdsize;
+  size_t                             m_ydsize;
+  size_t                             m_xtiles;
+  size_t                             m_ytiles;
+  elt_init                           m_init;
+  std::shared_ptr<const T>           m_blank;
+  std::shared_ptr<blank_tiles>       m_blank_tiles;
+  std::vector<std::shared_ptr<tile>> m_tiles;
+  // clang-format on
+};
+
+NS_END(representation, fordyca);
+
+#endif /* INCLUDE_FORDYCA_REPRESENTATION_TILED_GRID_HPP_ */
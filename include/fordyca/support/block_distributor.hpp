@@ -26,7 +26,12 @@
  ******************************************************************************/
 #include <argos3/core/utility/math/rng.h>
 #include <argos3/core/utility/math/vector2.h>
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 #include "rcppsw/common/common.hpp"
 #include "rcppsw/math/dcoord.hpp"
 
@@ -54,6 +59,17 @@ NS_START(support);
  * @brief Distributes all blocks as directed on simulation start, and then
  * re-dstributes individual blocks every time they are dropped in the nest
  * (unless respawn is not enabled).
+ *
+ * Blocks are only distributed to free cells (no block or cache) within the
+ * region of the arena the distribution model covers. The region is a handful
+ * of rectangles of cells, computed from the model's bounds rather than by
+ * visiting every cell. Its cells are numbered in order, and split into chunks
+ * of \ref kCHUNK_CELLS. Only the cells which are not free are recorded, in a
+ * bitmap per chunk which is allocated the first time one of its cells is
+ * filled, and the # of free cells in each chunk is kept in a Fenwick tree. So
+ * memory use is proportional to the # of chunks filled cells are in rather
+ * than the size of the region, and picking a free cell uniformly at random is
+ * O(log # chunks) no matter how densely packed the region is.
  */
 class block_distributor {
  public:
@@ -67,43 +83,120 @@ class block_distributor {
   block_distributor& operator=(const block_distributor& s) = delete;
 
   /**
-   * @brief Distribute a block in the arena.
+   * @brief Compute the distribution region for the arena grid, and mark all
+   * cells in it as free. Must be called before any blocks are distributed.
+   * Does not visit individual cells.
+   */
+  void grid_init(size_t xdsize, size_t ydsize, double resolution);
+
+  /**
+   * @brief Update whether or not a cell is free to have a block distributed
+   * to it. Cells outside the distribution region are ignored.
+   */
+  void cell_update(const rcppsw::math::dcoord2& d, bool free);
+
+  /**
+   * @brief Pick a free cell to distribute a block to.
+   *
+   * @return \c FALSE if no distribution needs to be done (respawn is
+   * disabled), or if there are no free cells left in the distribution region
+   * (see \ref free_cells_exhausted()), and \c TRUE otherwise.
    */
   bool distribute_block(const representation::block& block,
-                        argos::CVector2* coord);
+                        rcppsw::math::dcoord2* coord);
+
+  /**
+   * @brief \c TRUE iff blocks are being distributed, but there are no free
+   * cells left in the distribution region.
+   */
+  bool free_cells_exhausted(void) const {
+    return distributing() && 0 == m_n_free;
+  }
 
   argos::CRange<double> single_src_xrange(void);
 
  private:
+  static constexpr size_t kCHUNK_BITS = 10;
+  static constexpr size_t kCHUNK_CELLS = 1U << kCHUNK_BITS;
+
   /**
-   * @brief Distribute a block randomly in the arena (excluding nest extent)
-   * during initialization or after a robot has brought it to the
-   * nest. Collisions are not checked, as having 2 blocks on 1 square is not a
-   * big deal for now.
-   *
-   * @param block The block to place/distribute.
+   * @brief The cells [xmin, xmax) x [ymin, ymax), numbered in row major order
+   * starting from \c first.
    */
-  argos::CVector2 dist_random(const representation::block& block);
+  struct cell_rect {
+    size_t xmin;
+    size_t xmax;
+    size_t ymin;
+    size_t ymax;
+    size_t first;
+  };
+
+  /**
+   * @brief Which of a chunk's cells are not free.
+   */
+  using chunk_bitmap = std::array<uint64_t, kCHUNK_CELLS / 64>;
+  using cell_span = std::pair<size_t, size_t>;
+
+  bool distributing(void) const {
+    return "random" == m_dist_model || "single_source" == m_dist_model;
+  }
 
   /**
-   * @brief Distribute a block within a small range about 90% of the way between
+   * @brief Distribute blocks randomly in the arena (excluding nest extent)
+   * during initialization or after a robot has brought it to the nest.
+   */
+  void random_region_init(size_t xdsize, size_t ydsize, double resolution);
+
+  /**
+   * @brief Distribute blocks within a small range about 90% of the way between
    * the nest and the far wall. Assumes a horizontally rectangular arena.
    */
-  argos::CVector2 dist_single_src(const representation::block& block);
+  void single_src_region_init(size_t xdsize,
+                              size_t ydsize,
+                              double resolution);
+
+  /**
+   * @brief Get the span [low, high) of the \c n cells along an axis whose
+   * centers are within the specified range.
+   */
+  static cell_span axis_cells(const argos::CRange<double>& range,
+                              double resolution,
+                              size_t n);
+
+  void rect_add(cell_span x, cell_span y);
+
+  /**
+   * @brief Get the number of a cell within the region.
+   *
+   * @return \c FALSE if the cell is not in the region.
+   */
+  bool cell_number(const rcppsw::math::dcoord2& d, size_t* number) const;
+  rcppsw::math::dcoord2 cell_coord(size_t number) const;
+
+  /**
+   * @brief Update the Fenwick tree of free cell counts after one of a chunk's
+   * cells is freed or filled.
+   */
+  void chunk_free_update(size_t chunk, bool freed);
 
-  argos::CVector2 dist_in_range(argos::CRange<double> x_range,
-                                argos::CRange<double> y_range);
-  argos::CVector2 dist_outside_range(double dimension,
-                                     argos::CRange<double> x_range,
-                                     argos::CRange<double> y_range);
+  /**
+   * @brief Find the chunk containing the n-th free cell of the region, and
+   * make \c n the index of the cell among the free cells of that chunk.
+   */
+  size_t chunk_find(size_t* n) const;
 
   // clang-format off
-  std::string           m_dist_model;
-  argos::CRange<double> m_arena_x;
-  argos::CRange<double> m_arena_y;
-  argos::CRange<double> m_nest_x;
-  argos::CRange<double> m_nest_y;
-  argos::CRandom::CRNG* m_rng;
+  std::string                                m_dist_model;
+  double                                     m_block_dim;
+  argos::CRange<double>                      m_arena_x;
+  argos::CRange<double>                      m_arena_y;
+  argos::CRange<double>                      m_nest_x;
+  argos::CRange<double>                      m_nest_y;
+  argos::CRandom::CRNG*                      m_rng;
+  std::vector<cell_rect>                     m_region{};
+  size_t                                     m_n_free{0};
+  std::vector<size_t>                        m_chunk_free{};
+  std::vector<std::unique_ptr<chunk_bitmap>> m_filled{};
   // clang-format on
 };
 
@@ -29,7 +29,13 @@
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
-NS_START(fordyca, support, depth0);
+NS_START(fordyca);
+namespace controller {
+namespace depth0 { class stateful_foraging_controller; }
+}
+namespace metrics { namespace fsm { class stateful_metrics_collector; } }
+
+NS_START(support, depth0);
 
 /*******************************************************************************
  * Classes
@@ -51,11 +57,25 @@ class stateful_foraging_loop_functions : public stateless_foraging_loop_function
   ~stateful_foraging_loop_functions(void) override = default;
 
   void Init(argos::TConfigurationNode& node) override;
+  void Reset(void) override;
   void PreStep(void) override;
 
+ protected:
+  const metrics::collector_handle<metrics::fsm::stateful_metrics_collector>&
+  stateful_collector(void) const { return m_stateful_collector; }
+
  private:
-  void pre_step_iter(argos::CFootBotEntity& robot);
-  argos::CColor GetFloorColor(const argos::CVector2& plane_pos) override;
+  using controller_type = controller::depth0::stateful_foraging_controller;
+
+  void pre_step_metrics(const robot_registry<controller_type>::entry& r);
+  void pre_step_sense(const robot_registry<controller_type>::entry& r);
+  void pre_step_iter(const robot_registry<controller_type>::entry& r);
+
+  // clang-format off
+  metrics::collector_handle<metrics::fsm::stateful_metrics_collector>
+                                  m_stateful_collector{};
+  robot_registry<controller_type> m_robots{rcppsw::er::g_server};
+  // clang-format on
 };
 
 NS_END(depth0, support, fordyca);
@@ -27,14 +27,32 @@
 #include <string>
 #include "rcppsw/common/common.hpp"
 #include "fordyca/representation/arena_map.hpp"
+#include "fordyca/metrics/async_metrics_writer.hpp"
+#include "fordyca/metrics/collector_group.hpp"
+#include "fordyca/metrics/collector_handle.hpp"
+#include "fordyca/metrics/typed_metrics_collector.hpp"
 #include "fordyca/support/base_foraging_loop_functions.hpp"
-#include "rcppsw/metrics/collector_group.hpp"
+#include "fordyca/support/robot_registry.hpp"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca);
-namespace params { struct output_params; class loop_function_repository; }
+namespace params {
+struct output_params;
+struct profiling_params;
+class loop_function_repository;
+}
+namespace controller {
+namespace depth0 { class stateless_foraging_controller; }
+}
+namespace metrics {
+class block_metrics_collector;
+namespace fsm {
+class distance_metrics_collector;
+class stateless_metrics_collector;
+}
+}
 
 NS_START(support, depth0);
 
@@ -66,7 +84,31 @@ class stateless_foraging_loop_functions : public base_foraging_loop_functions,
   const std::shared_ptr<representation::arena_map>& arena_map(void) const { return m_arena_map; }
   std::shared_ptr<representation::arena_map>& arena_map(void) { return m_arena_map; }
 
-  rcppsw::metrics::collector_group& collector_group(void) { return m_collector_group; }
+  metrics::collector_group& collector_group(void) { return m_collector_group; }
+
+  /**
+   * @brief Register a collector with the collector group, and have it write
+   * its output via the background metrics writer.
+   *
+   * @return A handle for collecting from the collector without looking it up
+   * by name.
+   */
+  template<typename T>
+  metrics::collector_handle<T> collector_register(const std::string& name,
+                                                  const std::string& fname,
+                                                  uint interval) {
+    m_collector_group.register_collector<T>(name, fname, interval);
+    auto& collector = static_cast<T&>(*m_collector_group[name]);
+    collector.async_writer(&m_metrics_writer);
+    return metrics::collector_handle<T>(&collector);
+  }
+
+  const metrics::collector_handle<metrics::block_metrics_collector>&
+  block_collector(void) const { return m_block_collector; }
+  const metrics::collector_handle<metrics::fsm::distance_metrics_collector>&
+  distance_collector(void) const { return m_distance_collector; }
+  const metrics::collector_handle<metrics::fsm::stateless_metrics_collector>&
+  stateless_collector(void) const { return m_stateless_collector; }
 
   const argos::CRange<double>& nest_xrange(void) const { return m_nest_x; }
   const argos::CRange<double>& nest_yrange(void) const { return m_nest_y; }
@@ -75,8 +117,7 @@ class stateless_foraging_loop_functions : public base_foraging_loop_functions,
   const std::string& metrics_path(void) const { return m_metrics_path; }
 
   template<typename T>
-  void set_robot_tick(argos::CFootBotEntity& robot) {
-    auto& controller = dynamic_cast<T&>(robot.GetControllableEntity().GetController());
+  void set_robot_tick(T& controller) {
     controller.tick(GetSpace().GetSimulationClock());
   }
 
@@ -84,7 +125,18 @@ class stateless_foraging_loop_functions : public base_foraging_loop_functions,
   void arena_map_init(params::loop_function_repository& repo);
   void output_init(const struct params::output_params* p_output);
   void metric_collecting_init(const struct params::output_params* p_output);
-  void pre_step_iter(argos::CFootBotEntity& robot);
+  void profiling_init(const struct params::profiling_params* p_profiling);
+  using controller_type = controller::depth0::stateless_foraging_controller;
+
+  void pre_step_metrics(const robot_registry<controller_type>::entry& r);
+  void pre_step_sense(const robot_registry<controller_type>::entry& r);
+  void pre_step_iter(const robot_registry<controller_type>::entry& r);
+
+  /**
+   * @brief The maximum # of metrics rows waiting to be written before
+   * collection blocks.
+   */
+  static constexpr size_t kMETRICS_QUEUE_DEPTH = 256;
   argos::CColor GetFloorColor(const argos::CVector2& plane_pos) override;
 
   // clang-format off
@@ -92,9 +144,20 @@ class stateless_foraging_loop_functions : public base_foraging_loop_functions,
   argos::CRange<double>                      m_nest_y;
   std::string                                m_output_root;
   std::string                                m_metrics_path;
+  std::string                                m_profile_fname;
+  std::string                                m_profile_hist_fname;
 
-  rcppsw::metrics::collector_group           m_collector_group;
+  metrics::collector_group                   m_collector_group;
+  metrics::collector_handle<metrics::block_metrics_collector>
+                                             m_block_collector{};
+  metrics::collector_handle<metrics::fsm::distance_metrics_collector>
+                                             m_distance_collector{};
+  metrics::collector_handle<metrics::fsm::stateless_metrics_collector>
+                                             m_stateless_collector{};
+  /* after the collector group, so it is drained before collectors go away */
+  metrics::async_metrics_writer              m_metrics_writer;
   std::shared_ptr<representation::arena_map> m_arena_map;
+  robot_registry<controller_type>            m_robots{rcppsw::er::g_server};
   // clang-format on
 };
 
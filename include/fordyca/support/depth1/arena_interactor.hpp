@@ -126,9 +126,7 @@ class arena_interactor : public depth0::arena_interactor<T> {
    * robot for block pickup.
    */
   void finish_cached_block_pickup(T& controller) {
-    cache_penalty& p = m_cache_penalty_handler.next();
-    ER_ASSERT(p.controller() == &controller,
-              "FATAL: Out of order cache penalty handling");
+    const cache_penalty& p = m_cache_penalty_handler.penalty_find(controller);
     ER_ASSERT(controller.cache_acquired(),
               "FATAL: Controller not waiting for cached block pickup");
 
@@ -163,7 +161,7 @@ class arena_interactor : public depth0::arena_interactor<T> {
       controller.visitor::template visitable_any<T>::accept(pickup_op);
       floor()->SetChanged();
     }
-    m_cache_penalty_handler.remove(p);
+    m_cache_penalty_handler.remove(controller);
     ER_ASSERT(!m_cache_penalty_handler.is_serving_penalty(controller),
               "FATAL: Multiple instances of same controller serving cache penalty");
   }
@@ -173,9 +171,7 @@ class arena_interactor : public depth0::arena_interactor<T> {
    * has acquired a cache and is looking to drop an object in it.
    */
   void finish_cache_block_drop(T& controller) {
-    cache_penalty& p = m_cache_penalty_handler.next();
-    ER_ASSERT(p.controller() == &controller,
-              "FATAL: Out of order cache penalty handling");
+    const cache_penalty& p = m_cache_penalty_handler.penalty_find(controller);
     ER_ASSERT(controller.cache_acquired(),
               "FATAL: Controller not waiting for cache block drop");
 
@@ -210,7 +206,7 @@ class arena_interactor : public depth0::arena_interactor<T> {
       map()->accept(drop_op);
       controller.visitor::template visitable_any<T>::accept(drop_op);
     }
-    m_cache_penalty_handler.remove(p);
+    m_cache_penalty_handler.remove(controller);
     ER_ASSERT(!m_cache_penalty_handler.is_serving_penalty(controller),
               "FATAL: Multiple instances of same controller serving cache penalty");
   }
@@ -28,9 +28,9 @@
 #include <vector>
 #include <argos3/core/utility/math/vector2.h>
 
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/representation/real_coord.hpp"
 #include "fordyca/representation/arena_grid.hpp"
-#include "rcppsw/er/client.hpp"
 
 /*******************************************************************************
  * Namespaces
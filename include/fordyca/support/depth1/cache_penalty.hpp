@@ -50,16 +50,29 @@ class cache_penalty {
   cache_penalty(const controller::depth1::foraging_controller* const controller,
                       uint cache_id,
                       uint penalty,
-                      uint start_time) : m_cache_id(cache_id),
-                                         m_penalty(penalty),
-                                         m_start_time(start_time),
-                                         mc_controller(controller) {}
+                      uint start_time,
+                      int slot_key = -1) : m_cache_id(cache_id),
+                                           m_penalty(penalty),
+                                           m_start_time(start_time),
+                                           m_slot_key(slot_key),
+                                           mc_controller(controller) {}
 
   uint cache_id(void) const { return m_cache_id; }
   const controller::depth1::foraging_controller* controller(void) const { return mc_controller; }
   uint start_time(void) const { return m_start_time; }
   uint penalty(void) const { return m_penalty; }
 
+  /**
+   * @brief The timestep at which the penalty will be satisfied.
+   */
+  uint finish_time(void) const { return m_start_time + m_penalty; }
+
+  /**
+   * @brief The key of the cache whose completion timesteps the penalty
+   * occupies one of (the cache ID at the time the penalty was started).
+   */
+  int slot_key(void) const { return m_slot_key; }
+
   bool operator==(const cache_penalty& other) {
     return this->controller() == other.controller();
   }
@@ -76,6 +89,7 @@ class cache_penalty {
   uint                                                m_cache_id;
   uint                                                m_penalty;
   uint                                                m_start_time;
+  int                                                 m_slot_key;
   const controller::depth1::foraging_controller*const mc_controller;
   // clang-format on
 };
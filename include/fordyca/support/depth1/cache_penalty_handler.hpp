@@ -25,8 +25,11 @@
  * Includes
  ******************************************************************************/
 #include <argos3/plugins/robots/foot-bot/simulator/footbot_entity.h>
+#include <unordered_map>
 
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/support/depth1/cache_penalty.hpp"
+#include "fordyca/support/depth1/penalty_slots.hpp"
 #include "fordyca/support/loop_functions_utils.hpp"
 
 /*******************************************************************************
@@ -55,7 +58,11 @@ class cache_penalty_handler : public rcppsw::er::client {
   cache_penalty_handler(const std::shared_ptr<rcppsw::er::server>&server,
                         representation::arena_map& map,
                         uint penalty)
-      : client(server), mc_penalty(penalty), m_penalty_list(), m_map(map) {
+      : client(server),
+        mc_penalty(penalty),
+        m_penalties(),
+        m_slots(),
+        m_map(map) {
     insmod("cache_penalty_handler",
            rcppsw::er::er_lvl::DIAG,
            rcppsw::er::er_lvl::NOM);
@@ -89,11 +96,10 @@ class cache_penalty_handler : public rcppsw::er::client {
       ER_ASSERT(!is_serving_penalty<T>(controller),
                 "FATAL: Robot already serving cache penalty");
 
-      ER_NOM("fb%d: start=%u, duration=%u",
-             utils::robot_id(controller),
-             timestep,
-             mc_penalty);
-      uint penalty = mc_penalty;
+      ER_DIAG("fb%d: start=%u, duration=%u",
+              utils::robot_id(controller),
+              timestep,
+              mc_penalty);
 
       /*
        * Due to assertions in the \ref cache_block_pickup, if two robots enter
@@ -102,20 +108,19 @@ class cache_penalty_handler : public rcppsw::er::client {
        * different amount of blocks than it should (i.e. only one block pickup
        * is allowed per timestep, otherwise the world is inconsistent).
        *
-       * Work around this by extending the penalty of the second robot to not
-       * conflict with any other robots currently waiting/starting to wait.
+       * Work around this by extending the penalty of the second robot to the
+       * first timestep at which no other robot waiting at the same cache
+       * finishes.
        */
-      for (auto it = m_penalty_list.begin(); it != m_penalty_list.end(); ++it) {
-        if (it->start_time() + it->penalty() == timestep + penalty) {
-          ++penalty;
-          it = m_penalty_list.begin();
-        }
-      } /* for(i..) */
-
-      m_penalty_list.push_back(cache_penalty(&controller,
-                                             cache_id,
-                                             penalty,
-                                             timestep));
+      int slot_key = m_map.caches()[cache_id]->id();
+      uint finish = m_slots[slot_key].alloc(timestep + mc_penalty);
+
+      m_penalties.emplace(&controller,
+                          cache_penalty(&controller,
+                                        cache_id,
+                                        finish - timestep,
+                                        timestep,
+                                        slot_key));
       return true;
     }
     return false;
@@ -134,28 +139,49 @@ class cache_penalty_handler : public rcppsw::er::client {
   template<typename T>
   bool penalty_satisfied(T& controller,
                          uint timestep) {
-    auto it = std::find_if(m_penalty_list.begin(), m_penalty_list.end(),
-                           [&](const cache_penalty& p) {
-                             return p.controller() == &controller;});
-    if (it != m_penalty_list.end()) {
-      return it->penalty_satisfied(timestep);
+    auto it = m_penalties.find(&controller);
+    if (it != m_penalties.end()) {
+      return it->second.penalty_satisfied(timestep);
     }
     return false;
   }
-  cache_penalty& next(void) {return m_penalty_list.front(); }
-  void remove(cache_penalty& victim) { return m_penalty_list.remove(victim); }
 
+  /**
+   * @brief Get the penalty the specified robot is serving. The robot MUST be
+   * serving a penalty.
+   */
   template<typename T>
-  void penalty_abort(T& controller) {
-    auto it = std::find_if(m_penalty_list.begin(),
-                           m_penalty_list.end(),
-                           [&](const cache_penalty& p) {
-                             return p.controller() == &controller;
-                           });
-    if (it != m_penalty_list.end()) {
-      m_penalty_list.remove(*it);
+  cache_penalty& penalty_find(T& controller) {
+    auto it = m_penalties.find(&controller);
+    ER_ASSERT(it != m_penalties.end(),
+              "FATAL: fb%d not serving cache penalty",
+              utils::robot_id(controller));
+    return it->second;
+  }
+
+  /**
+   * @brief Remove the penalty for the specified robot (if it is serving one),
+   * freeing up its completion timestep for its cache.
+   */
+  template<typename T>
+  void remove(T& controller) {
+    auto it = m_penalties.find(&controller);
+    if (it != m_penalties.end()) {
+      auto slots = m_slots.find(it->second.slot_key());
+      if (slots != m_slots.end()) {
+        slots->second.free(it->second.finish_time());
+        if (slots->second.empty()) {
+          m_slots.erase(slots);
+        }
+      }
+      m_penalties.erase(it);
     }
-    ER_NOM("fb%d", utils::robot_id(controller));
+  }
+
+  template<typename T>
+  void penalty_abort(T& controller) {
+    remove(controller);
+    ER_DIAG("fb%d", utils::robot_id(controller));
     ER_ASSERT(!is_serving_penalty<T>(controller),
               "FATAL: Robot still serving penalty after abort");
   }
@@ -166,18 +192,19 @@ class cache_penalty_handler : public rcppsw::er::client {
    */
   template<typename T>
   bool is_serving_penalty(T& controller) {
-    auto it = std::find_if(m_penalty_list.begin(), m_penalty_list.end(),
-                           [&](const cache_penalty& p) {
-                             return p.controller() == &controller; });
-    return it != m_penalty_list.end();
+    return m_penalties.end() != m_penalties.find(&controller);
   }
 
-
  private:
+  using penalty_map =
+      std::unordered_map<const controller::depth1::foraging_controller*,
+                         cache_penalty>;
+
   // clang-format off
-  uint                       mc_penalty;
-  std::list<cache_penalty>   m_penalty_list;
-  representation::arena_map& m_map;
+  uint                                   mc_penalty;
+  penalty_map                            m_penalties;
+  std::unordered_map<int, penalty_slots> m_slots;
+  representation::arena_map&             m_map;
   // clang-format on
 };
 NS_END(depth1, support, fordyca);
@@ -33,7 +33,17 @@
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
-NS_START(fordyca, support, depth1);
+NS_START(fordyca);
+namespace metrics {
+class cache_metrics_collector;
+namespace fsm { class depth1_metrics_collector; }
+namespace tasks {
+class execution_metrics_collector;
+class management_metrics_collector;
+}
+}
+
+NS_START(support, depth1);
 
 /*******************************************************************************
  * Classes
@@ -61,58 +71,63 @@ class foraging_loop_functions : public depth0::stateful_foraging_loop_functions
   /**
    * @brief Set the LOS of a robot in the arena, INCLUDING handling caches whose
    * extent overlaps the LOS but whose host cell is not in the LOS (see #244).
+   *
+   * Called for multiple robots in parallel, so must not modify the arena (or
+   * log); the part of the arena grid the LOS covers must already have been
+   * allocated via \ref utils::robot_los_allocate().
    */
   template<typename T>
-  void set_robot_los(argos::CFootBotEntity& robot,
-                     representation::arena_map& map) {
-    argos::CVector2 pos;
-    pos.Set(const_cast<argos::CFootBotEntity&>(robot).GetEmbodiedEntity().GetOriginAnchor().Position.GetX(),
-            const_cast<argos::CFootBotEntity&>(robot).GetEmbodiedEntity().GetOriginAnchor().Position.GetY());
-
-    rcppsw::math::dcoord2 robot_loc =
-        math::rcoord_to_dcoord(pos, map.grid_resolution());
-    auto& controller = dynamic_cast<T&>(robot.GetControllableEntity().GetController());
-    std::unique_ptr<representation::line_of_sight> new_los =
-        rcppsw::make_unique<representation::line_of_sight>(
-            map.subgrid(robot_loc.first, robot_loc.second, 2),
-            robot_loc);
+  void set_robot_los(const argos::CFootBotEntity& robot,
+                     T& controller,
+                     const representation::arena_map& map) {
+    rcppsw::math::dcoord2 robot_loc = utils::robot_dloc(robot, map);
+    representation::line_of_sight& los = controller.los_retarget(
+        map.grid(), robot_loc, utils::kROBOT_LOS_RADIUS);
 
     /*
      * [JRH]: TODO: Once caches are arena entities, then this make not be
      * necessary.
      */
     for (auto &c : map.caches()) {
-      argos::CVector2 ll = math::dcoord_to_rcoord(new_los->abs_ll(),
+      argos::CVector2 ll = math::dcoord_to_rcoord(los.abs_ll(),
                                                   map.grid_resolution());
-      argos::CVector2 lr = math::dcoord_to_rcoord(new_los->abs_lr(),
+      argos::CVector2 lr = math::dcoord_to_rcoord(los.abs_lr(),
                                                   map.grid_resolution());
-      argos::CVector2 ul = math::dcoord_to_rcoord(new_los->abs_ul(),
+      argos::CVector2 ul = math::dcoord_to_rcoord(los.abs_ul(),
                                                   map.grid_resolution());
-      argos::CVector2 ur = math::dcoord_to_rcoord(new_los->abs_ur(),
+      argos::CVector2 ur = math::dcoord_to_rcoord(los.abs_ur(),
                                                   map.grid_resolution());
       if (c->contains_point(ll) || c->contains_point(lr) ||
           c->contains_point(ul) || c->contains_point(ur)) {
-        ER_VER("Add partially overlapping cache to %s LOS",
-                controller.GetId().c_str());
-        new_los->cache_add(c);
+        los.cache_add(c);
       }
     } /* for(&c..) */
-
-    controller.los(new_los);
   }
 
  private:
-  using interactor = arena_interactor<controller::depth1::foraging_controller>;
+  using controller_type = controller::depth1::foraging_controller;
+  using interactor = arena_interactor<controller_type>;
 
   void pre_step_final(void) override;
-  void pre_step_iter(argos::CFootBotEntity& robot);
-  argos::CColor GetFloorColor(const argos::CVector2& plane_pos) override;
+  void pre_step_metrics(const robot_registry<controller_type>::entry& r);
+  void pre_step_sense(const robot_registry<controller_type>::entry& r);
+  void pre_step_iter(const robot_registry<controller_type>::entry& r);
   void metric_collecting_init(const struct params::output_params *output_p);
   void cache_handling_init(const struct params::arena_map_params *arenap);
 
   // clang-format off
-  double                      mc_cache_respawn_scale_factor{0.0};
-  std::unique_ptr<interactor> m_interactor{nullptr};
+  double                          mc_cache_respawn_scale_factor{0.0};
+  std::unique_ptr<interactor>     m_interactor{nullptr};
+  robot_registry<controller_type> m_robots{rcppsw::er::g_server};
+
+  metrics::collector_handle<metrics::fsm::depth1_metrics_collector>
+      m_depth1_collector{};
+  metrics::collector_handle<metrics::tasks::execution_metrics_collector>
+      m_execution_collector{};
+  metrics::collector_handle<metrics::tasks::management_metrics_collector>
+      m_management_collector{};
+  metrics::collector_handle<metrics::cache_metrics_collector>
+      m_cache_collector{};
   // clang-format on
 };
 
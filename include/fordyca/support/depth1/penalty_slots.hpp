@@ -0,0 +1,124 @@
+/**
+ * @file penalty_slots.hpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_SUPPORT_DEPTH1_PENALTY_SLOTS_HPP_
+#define INCLUDE_FORDYCA_SUPPORT_DEPTH1_PENALTY_SLOTS_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <iterator>
+#include <map>
+
+#include "rcppsw/common/common.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, support, depth1);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class penalty_slots
+ * @ingroup support depth1
+ *
+ * @brief The completion timesteps in use by the robots serving penalties at a
+ * single cache, stored as disjoint, non-adjacent, closed intervals [start ->
+ * end], so that allocating and freeing are O(log n).
+ */
+class penalty_slots {
+ public:
+  penalty_slots(void) : m_slots() {}
+
+  /**
+   * @brief If \c TRUE, no completion timesteps are in use.
+   */
+  bool empty(void) const { return m_slots.empty(); }
+
+  /**
+   * @brief If \c TRUE, the specified completion timestep is in use.
+   */
+  bool in_use(uint slot) const {
+    auto next = m_slots.upper_bound(slot);
+    return next != m_slots.begin() && std::prev(next)->second >= slot;
+  }
+
+  /**
+   * @brief Allocate the first unused completion timestep >= the requested one.
+   */
+  uint alloc(uint requested) {
+    uint slot = requested;
+    auto next = m_slots.upper_bound(slot);
+    if (next != m_slots.begin()) {
+      auto prev = std::prev(next);
+      if (prev->second >= slot) { /* taken--first free is just past interval */
+        slot = prev->second + 1;
+      }
+    }
+    /* merge with the interval ending just before/starting just after */
+    auto after = m_slots.find(slot + 1);
+    uint end = (after != m_slots.end()) ? after->second : slot;
+    if (after != m_slots.end()) {
+      m_slots.erase(after);
+    }
+    next = m_slots.upper_bound(slot);
+    if (next != m_slots.begin() && std::prev(next)->second + 1 == slot) {
+      std::prev(next)->second = end;
+    } else {
+      m_slots[slot] = end;
+    }
+    return slot;
+  }
+
+  /**
+   * @brief Return a completion timestep to the pool of unused ones. Freeing an
+   * unused timestep does nothing.
+   */
+  void free(uint slot) {
+    auto next = m_slots.upper_bound(slot);
+    if (next == m_slots.begin()) {
+      return;
+    }
+    auto it = std::prev(next);
+    uint start = it->first;
+    uint end = it->second;
+    if (end < slot) {
+      return;
+    }
+    m_slots.erase(it);
+    if (start < slot) {
+      m_slots[start] = slot - 1;
+    }
+    if (end > slot) {
+      m_slots[slot + 1] = end;
+    }
+  }
+
+ private:
+  // clang-format off
+  std::map<uint, uint> m_slots;
+  // clang-format on
+};
+
+NS_END(depth1, support, fordyca);
+
+#endif /* INCLUDE_FORDYCA_SUPPORT_DEPTH1_PENALTY_SLOTS_HPP_ */
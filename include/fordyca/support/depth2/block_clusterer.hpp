@@ -0,0 +1,97 @@
+/**
+ * @file block_clusterer.hpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_SUPPORT_DEPTH2_BLOCK_CLUSTERER_HPP_
+#define INCLUDE_FORDYCA_SUPPORT_DEPTH2_BLOCK_CLUSTERER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "rcppsw/common/common.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca);
+namespace representation { class block; }
+NS_START(support, depth2);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class block_clusterer
+ * @ingroup support depth2
+ *
+ * @brief Partitions a set of blocks into disjoint clusters, where two blocks
+ * are in the same cluster if there is a chain of blocks between them with no
+ * link longer than the minimum distance (single-linkage clustering).
+ *
+ * Blocks are bucketed into a uniform grid whose cells are the size of the
+ * minimum distance, so that only blocks in neighboring grid cells need to be
+ * compared, and linked blocks are merged with union-find. For reasonably
+ * distributed blocks this is O(n log n).
+ *
+ * The output is deterministic for a given input: clusters are ordered by the
+ * index of their first block in the input, and the blocks within a cluster are
+ * in input order.
+ */
+class block_clusterer {
+ public:
+  using block_vector = std::vector<std::shared_ptr<representation::block>>;
+  using block_list = std::list<std::shared_ptr<representation::block>>;
+
+  explicit block_clusterer(double min_dist)
+      : m_min_dist(min_dist), m_parent(), m_rank(), m_buckets() {}
+
+  /**
+   * @brief Compute the clusters of at least \p min_size blocks within the
+   * specified blocks.
+   */
+  std::vector<block_list> clusters(const block_vector& blocks,
+                                   size_t min_size);
+
+ private:
+  using bucket_key = std::pair<long, long>;
+  using bucket_entry = std::pair<bucket_key, size_t>;
+
+  bucket_key bucket(const std::shared_ptr<representation::block>& block) const;
+  void buckets_link(const block_vector& blocks,
+                    size_t begin1, size_t end1,
+                    size_t begin2, size_t end2);
+  size_t find(size_t i);
+  void join(size_t i, size_t j);
+
+  // clang-format off
+  double                    m_min_dist;
+  std::vector<size_t>       m_parent;
+  std::vector<uint8_t>      m_rank;
+  std::vector<bucket_entry> m_buckets;
+  // clang-format on
+};
+
+NS_END(depth2, support, fordyca);
+
+#endif /* INCLUDE_FORDYCA_SUPPORT_DEPTH2_BLOCK_CLUSTERER_HPP_ */
@@ -25,6 +25,7 @@
  * Includes
  ******************************************************************************/
 #include "fordyca/support/depth1/cache_creator.hpp"
+#include "fordyca/support/depth2/block_clusterer.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -42,7 +43,8 @@ class dynamic_cache_creator : public depth1::cache_creator {
 
   /**
    * @brief Scan the entire list of blocks currently in the arena, and create
-   * caches from all blocks that are close enough together.
+   * caches from all clusters of blocks that are close enough together (see
+   * \ref block_clusterer).
    *
    * @return The list of current caches.
    */
@@ -51,7 +53,7 @@ class dynamic_cache_creator : public depth1::cache_creator {
  private:
   argos::CVector2 calc_center(const block_list& blocks);
 
-  double m_min_dist;
+  block_clusterer m_clusterer;
 };
 
 NS_END(depth2, support, fordyca);
@@ -43,6 +43,14 @@ class base_foraging_controller;
 
 NS_START(support, utils);
 
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+/**
+ * @brief The radius (in cells) of a robot's LOS.
+ */
+constexpr size_t kROBOT_LOS_RADIUS = 2;
+
 /*******************************************************************************
  * Functions
  ******************************************************************************/
@@ -99,51 +107,45 @@ bool block_drop_overlap_with_nest(
  * by the robot.
  */
 template <typename T>
-void set_robot_pos(argos::CFootBotEntity& robot) {
-  argos::CVector2 pos;
-  pos.Set(const_cast<argos::CFootBotEntity&>(robot)
-              .GetEmbodiedEntity()
-              .GetOriginAnchor()
-              .Position.GetX(),
-          const_cast<argos::CFootBotEntity&>(robot)
-              .GetEmbodiedEntity()
-              .GetOriginAnchor()
-              .Position.GetY());
-
-  auto& controller =
-      dynamic_cast<T&>(robot.GetControllableEntity().GetController());
-  controller.robot_loc(pos);
+void set_robot_pos(const argos::CFootBotEntity& robot, T& controller) {
+  const argos::CVector3& pos3 =
+      const_cast<argos::CFootBotEntity&>(robot)
+          .GetEmbodiedEntity()
+          .GetOriginAnchor()
+          .Position;
+  controller.robot_loc(argos::CVector2(pos3.GetX(), pos3.GetY()));
 }
 
+/**
+ * @brief Get the discrete location of a robot in the arena.
+ */
+rcppsw::math::dcoord2 robot_dloc(const argos::CFootBotEntity& robot,
+                                 const representation::arena_map& map);
+
+/**
+ * @brief Allocate the part of the arena grid that the LOS of a robot will
+ * cover, so that \ref set_robot_los() only reads the arena. Must be called for
+ * all robots serially, before their LOS are set.
+ */
+void robot_los_allocate(const argos::CFootBotEntity& robot,
+                        representation::arena_map& map);
+
 /**
  * @brief Set the LOS of a robot in the arena.
  *
  * This is a hack that makes getting my research up and running easier.
  *
+ * Only reads the arena, so that it can be called for many robots in parallel.
+ *
  * @todo This should eventually be replaced by a calculation of a robot's LOS by
  * the robot, probably using on-board cameras.
  */
 template <typename T>
-void set_robot_los(argos::CFootBotEntity& robot,
-                   representation::arena_map& map) {
-  argos::CVector2 pos;
-  pos.Set(const_cast<argos::CFootBotEntity&>(robot)
-              .GetEmbodiedEntity()
-              .GetOriginAnchor()
-              .Position.GetX(),
-          const_cast<argos::CFootBotEntity&>(robot)
-              .GetEmbodiedEntity()
-              .GetOriginAnchor()
-              .Position.GetY());
-
-  rcppsw::math::dcoord2 robot_loc =
-      math::rcoord_to_dcoord(pos, map.grid_resolution());
-  auto& controller =
-      dynamic_cast<T&>(robot.GetControllableEntity().GetController());
-  std::unique_ptr<representation::line_of_sight> new_los =
-      rcppsw::make_unique<representation::line_of_sight>(
-          map.subgrid(robot_loc.first, robot_loc.second, 2), robot_loc);
-  controller.los(new_los);
+void set_robot_los(const argos::CFootBotEntity& robot,
+                   T& controller,
+                   const representation::arena_map& map) {
+  rcppsw::math::dcoord2 robot_loc = robot_dloc(robot, map);
+  controller.los_retarget(map.grid(), robot_loc, kROBOT_LOS_RADIUS);
 }
 
 NS_END(utils, support, fordyca);
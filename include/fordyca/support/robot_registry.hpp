@@ -0,0 +1,111 @@
+/**
+ * @file robot_registry.hpp
+ * @ingroup support
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_SUPPORT_ROBOT_REGISTRY_HPP_
+#define INCLUDE_FORDYCA_SUPPORT_ROBOT_REGISTRY_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <argos3/core/simulator/space/space.h>
+#include <argos3/plugins/robots/foot-bot/simulator/footbot_entity.h>
+#include <memory>
+#include <vector>
+
+#include "fordyca/er/er_profile.hpp"
+#include "rcppsw/er/server.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, support);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @class robot_registry
+ * @ingroup support
+ *
+ * @brief A dense array of the foot-bots in the arena and their controllers,
+ * resolved once so that the loop functions do not have to look up and cast
+ * each robot's controller every timestep.
+ *
+ * The position of a robot in the registry is its index, which is stable until
+ * the registry is rebuilt. Robots are stored in the same order that ARGoS
+ * returns them.
+ *
+ * Each robot's controller is checked to be a T once, when the registry is
+ * built, so looking up a controller afterwards does not need a cast.
+ *
+ * @tparam T The type of the controller for all robots in the arena.
+ */
+template <typename T>
+class robot_registry : public rcppsw::er::client {
+ public:
+  struct entry {
+    argos::CFootBotEntity* robot;
+    T* controller;
+  };
+  using const_iterator = typename std::vector<entry>::const_iterator;
+
+  explicit robot_registry(const std::shared_ptr<rcppsw::er::server>& server)
+      : client(server), m_entries() {
+    insmod("robot_registry", rcppsw::er::er_lvl::DIAG, rcppsw::er::er_lvl::NOM);
+  }
+
+  ~robot_registry(void) override { client::rmmod(); }
+
+  robot_registry(const robot_registry& other) = delete;
+  robot_registry& operator=(const robot_registry& other) = delete;
+
+  /**
+   * @brief (Re)build the registry from the foot-bots in the arena. Must be
+   * called after all robots have been added, and whenever robots are
+   * added/removed.
+   */
+  void build(argos::CSpace& space) {
+    m_entries.clear();
+    for (auto& entity_pair : space.GetEntitiesByType("foot-bot")) {
+      auto* robot = argos::any_cast<argos::CFootBotEntity*>(entity_pair.second);
+      auto* controller =
+          dynamic_cast<T*>(&robot->GetControllableEntity().GetController());
+      ER_ASSERT(nullptr != controller,
+                "FATAL: %s does not have the expected controller type",
+                robot->GetId().c_str());
+      m_entries.push_back({robot, controller});
+    } /* for(&entity_pair..) */
+  }
+
+  size_t size(void) const { return m_entries.size(); }
+  const entry& operator[](size_t index) const { return m_entries[index]; }
+  const_iterator begin(void) const { return m_entries.begin(); }
+  const_iterator end(void) const { return m_entries.end(); }
+
+ private:
+  // clang-format off
+  std::vector<entry> m_entries;
+  // clang-format on
+};
+
+NS_END(support, fordyca);
+
+#endif /* INCLUDE_FORDYCA_SUPPORT_ROBOT_REGISTRY_HPP_ */
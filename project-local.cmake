@@ -13,6 +13,13 @@ set(CMAKE_AUTOMOC OFF)
 add_subdirectory(ext/rcppsw)
 include_directories(${rcppsw_INCLUDE_DIRS})
 
+# OpenMP (parallel per-robot processing in the loop functions; runs serially
+# without it)
+find_package(OpenMP)
+if (OPENMP_FOUND)
+  set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}")
+endif()
+
 ################################################################################
 # Includes                                                                     #
 ################################################################################
@@ -27,6 +34,35 @@ include_directories(BEFORE SYSTEM
   ${Qt5Widgets_INCLUDE_DIRS}
   )
 
+################################################################################
+# Event Reporting                                                              #
+################################################################################
+# The event reporting levels compiled into the library:
+#
+# ALL     - Everything (default for non-release builds).
+# RELEASE - Everything except diagnostic/verbose reports (default for release
+#           builds).
+# QUIET   - Only warnings and errors.
+if (NOT FORDYCA_ER_PROFILE)
+  if ("${CMAKE_BUILD_TYPE}" STREQUAL "Release")
+    set(FORDYCA_ER_PROFILE RELEASE)
+  else()
+    set(FORDYCA_ER_PROFILE ALL)
+  endif()
+endif()
+set(FORDYCA_ER_PROFILE ${FORDYCA_ER_PROFILE} CACHE STRING
+  "Event reporting levels to compile in: ALL, RELEASE, QUIET")
+
+if ("${FORDYCA_ER_PROFILE}" STREQUAL "ALL")
+  add_definitions(-DFORDYCA_ER_MAX_LVL=FORDYCA_ER_LVL_VER)
+elseif ("${FORDYCA_ER_PROFILE}" STREQUAL "RELEASE")
+  add_definitions(-DFORDYCA_ER_MAX_LVL=FORDYCA_ER_LVL_NOM)
+elseif ("${FORDYCA_ER_PROFILE}" STREQUAL "QUIET")
+  add_definitions(-DFORDYCA_ER_MAX_LVL=FORDYCA_ER_LVL_WARN)
+else()
+  message(FATAL_ERROR "Bad FORDYCA_ER_PROFILE: ${FORDYCA_ER_PROFILE}")
+endif()
+
 ################################################################################
 # Libraries                                                                    #
 ################################################################################
@@ -42,4 +78,29 @@ target_link_libraries(${target}
   argos3plugin_simulator_footbot
   argos3plugin_simulator_genericrobot
   stdc++fs
+  pthread
   )
+
+################################################################################
+# Tools                                                                        #
+################################################################################
+# Converts binary columnar metrics files to CSV
+add_executable(fcol2csv ${CMAKE_CURRENT_LIST_DIR}/tools/fcol2csv.cpp)
+
+# Runs parameter sweeps of experiments in parallel
+add_executable(sweep ${CMAKE_CURRENT_LIST_DIR}/tools/sweep.cpp)
+target_link_libraries(sweep stdc++fs)
+
+################################################################################
+# Benchmarks                                                                   #
+################################################################################
+# Standalone microbenchmarks for the arena representation, selectors, and cache
+# handling. ARGoS is only linked for its math/RNG utilities; no simulation is
+# run.
+find_package(benchmark QUIET)
+if (benchmark_FOUND)
+  file(GLOB ${target}_BENCH_SRC ${CMAKE_CURRENT_LIST_DIR}/bench/*.cpp)
+  add_executable(${target}-bench ${${target}_BENCH_SRC})
+  target_include_directories(${target}-bench PRIVATE ${CMAKE_CURRENT_LIST_DIR})
+  target_link_libraries(${target}-bench ${target} benchmark::benchmark)
+endif()
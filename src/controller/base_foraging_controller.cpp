@@ -27,6 +27,7 @@
 #include <argos3/plugins/robots/foot-bot/control_interface/ci_footbot_proximity_sensor.h>
 #include <argos3/plugins/robots/generic/control_interface/ci_range_and_bearing_sensor.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <cstdlib>
 #include <experimental/filesystem>
 #include <fstream>
 
@@ -37,6 +38,7 @@
 #include "fordyca/params/fsm_params.hpp"
 #include "fordyca/params/output_params.hpp"
 #include "fordyca/params/sensor_params.hpp"
+#include "fordyca/params/shared_repository.hpp"
 #include "rcppsw/er/server.hpp"
 
 /*******************************************************************************
@@ -83,27 +85,29 @@ __pure argos::CVector2 base_foraging_controller::robot_loc(void) const {
 
 void base_foraging_controller::Init(argos::TConfigurationNode& node) {
   ER_NOM("Initializing base foraging controller");
-  params::depth0::stateless_foraging_repository param_repo;
-  param_repo.parse_all(node);
-  ER_ASSERT(param_repo.validate_all(),
-            "FATAL: Not all parameters were validated");
+  /* +2 because the ID string starts with 'fb' */
+  m_entity_id = std::atoi(GetId().c_str() + 2);
+
+  using repo_type = params::depth0::stateless_foraging_repository;
+  auto* param_repo = params::shared_repository::get<repo_type>(
+      node, client::server_handle()->log_stream());
+  ER_ASSERT(nullptr != param_repo, "FATAL: Not all parameters were validated");
 
   const struct params::output_params* params =
       static_cast<const struct params::output_params*>(
-          param_repo.get_params("output"));
-  param_repo.show_all(client::server_handle()->log_stream());
+          param_repo->get_params("output"));
   output_init(params);
 
   m_actuators = std::make_shared<actuator_manager>(
       static_cast<const struct params::actuator_params*>(
-          param_repo.get_params("actuators")),
+          param_repo->get_params("actuators")),
       GetActuator<argos::CCI_DifferentialSteeringActuator>(
           "differential_steering"),
       GetActuator<argos::CCI_LEDsActuator>("leds"),
       GetActuator<argos::CCI_RangeAndBearingActuator>("range_and_bearing"));
 
   auto* fsm_params = static_cast<const struct params::fsm_params*>(
-      param_repo.get_params("fsm"));
+      param_repo->get_params("fsm"));
 
   m_speed_throttle_block_carry = fsm_params->speed_throttling.block_carry;
   if (m_speed_throttle_block_carry > 0) {
@@ -112,7 +116,7 @@ void base_foraging_controller::Init(argos::TConfigurationNode& node) {
 
   m_sensors = std::make_shared<base_foraging_sensors>(
       static_cast<const struct params::sensor_params*>(
-          param_repo.get_params("sensors")),
+          param_repo->get_params("sensors")),
       GetSensor<argos::CCI_RangeAndBearingSensor>("range_and_bearing"),
       GetSensor<argos::CCI_FootBotProximitySensor>("footbot_proximity"),
       GetSensor<argos::CCI_FootBotLightSensor>("footbot_light"),
@@ -38,6 +38,6 @@ foraging_sensors::foraging_sensors(
     argos::CCI_FootBotLightSensor* const light,
     argos::CCI_FootBotMotorGroundSensor* const ground)
     : base_foraging_sensors(c_params, rabs, proximity, light, ground),
-      m_los(nullptr) {}
+      m_los() {}
 
 NS_END(depth0, controller, fordyca);
@@ -33,12 +33,14 @@
 #include "fordyca/events/block_found.hpp"
 #include "fordyca/events/cell_empty.hpp"
 #include "fordyca/fsm/depth0/stateful_foraging_fsm.hpp"
+#include "fordyca/metrics/tick_profiler.hpp"
 #include "fordyca/params/depth0/occupancy_grid_params.hpp"
 #include "fordyca/params/depth0/stateful_foraging_repository.hpp"
 #include "fordyca/params/depth1/task_allocation_params.hpp"
 #include "fordyca/params/depth1/task_repository.hpp"
 #include "fordyca/params/fsm_params.hpp"
 #include "fordyca/params/sensor_params.hpp"
+#include "fordyca/params/shared_repository.hpp"
 #include "fordyca/representation/base_cache.hpp"
 #include "fordyca/representation/block.hpp"
 #include "fordyca/representation/line_of_sight.hpp"
@@ -83,10 +85,12 @@ __pure const representation::line_of_sight* stateful_foraging_controller::los(
     void) const {
   return stateful_sensors()->los();
 }
-void stateful_foraging_controller::los(
-    std::unique_ptr<representation::line_of_sight>& new_los) {
-  stateful_sensors()->los(new_los);
-}
+representation::line_of_sight& stateful_foraging_controller::los_retarget(
+    const representation::arena_grid& grid,
+    const rcppsw::math::dcoord2& center,
+    size_t radius) {
+  return stateful_sensors()->los_retarget(grid, center, radius);
+} /* los_retarget() */
 
 __pure depth1::foraging_sensors* stateful_foraging_controller::stateful_sensors(
     void) const {
@@ -103,8 +107,11 @@ void stateful_foraging_controller::ControlStep(void) {
    * the relevance of information within it. Then, you can run the main FSM
    * loop.
    */
-  process_los(stateful_sensors()->los());
-  m_map->update();
+  {
+    metrics::phase_timer timer(metrics::tick_phase::kPROCESS_LOS);
+    process_los(stateful_sensors()->los());
+  }
+  m_map->update(stateful_sensors()->tick());
 
   if (is_carrying_block()) {
     actuators()->set_speed_throttle(true);
@@ -112,13 +119,11 @@ void stateful_foraging_controller::ControlStep(void) {
     actuators()->set_speed_throttle(false);
   }
 
+  metrics::phase_timer timer(metrics::tick_phase::kEXECUTIVE_RUN);
   m_executive->run();
 } /* ControlStep() */
 
 void stateful_foraging_controller::Init(argos::TConfigurationNode& node) {
-  params::depth0::stateful_foraging_repository param_repo;
-  params::depth1::task_repository task_repo;
-
   /*
    * Note that we do not call the stateless_foraging_controller::Init()--there
    * is nothing in there that we need.
@@ -126,24 +131,25 @@ void stateful_foraging_controller::Init(argos::TConfigurationNode& node) {
   base_foraging_controller::Init(node);
 
   ER_NOM("Initializing stateful_foraging controller");
-  param_repo.parse_all(node);
-  task_repo.parse_all(node);
-  param_repo.show_all(server_handle()->log_stream());
-  task_repo.show_all(server_handle()->log_stream());
-  ER_ASSERT(param_repo.validate_all(),
-            "FATAL: Not all parameters were validated");
-  ER_ASSERT(task_repo.validate_all(),
+  auto* param_repo = params::shared_repository::get<
+      params::depth0::stateful_foraging_repository>(
+      node, server_handle()->log_stream());
+  auto* task_repo =
+      params::shared_repository::get<params::depth1::task_repository>(
+          node, server_handle()->log_stream());
+  ER_ASSERT(nullptr != param_repo, "FATAL: Not all parameters were validated");
+  ER_ASSERT(nullptr != task_repo,
             "FATAL: Not all task parameters were validated");
 
   m_map = rcppsw::make_unique<representation::perceived_arena_map>(
       server(),
       static_cast<const struct params::depth0::occupancy_grid_params*>(
-          param_repo.get_params("occupancy_grid")),
+          param_repo->get_params("occupancy_grid")),
       GetId());
 
   base_sensors(rcppsw::make_unique<depth1::foraging_sensors>(
       static_cast<const struct params::sensor_params*>(
-          param_repo.get_params("sensors")),
+          param_repo->get_params("sensors")),
       GetSensor<argos::CCI_RangeAndBearingSensor>("range_and_bearing"),
       GetSensor<argos::CCI_FootBotProximitySensor>("footbot_proximity"),
       GetSensor<argos::CCI_FootBotLightSensor>("footbot_light"),
@@ -151,11 +157,11 @@ void stateful_foraging_controller::Init(argos::TConfigurationNode& node) {
 
   const params::fsm_params* fsm_params =
       static_cast<const struct params::fsm_params*>(
-          param_repo.get_params("fsm"));
+          param_repo->get_params("fsm"));
 
   const params::depth1::task_allocation_params* task_params =
       static_cast<const params::depth1::task_allocation_params*>(
-          task_repo.get_params("task_allocation"));
+          task_repo->get_params("task_allocation"));
 
   std::unique_ptr<task_allocation::taskable> generalist_fsm =
       rcppsw::make_unique<fsm::depth0::stateful_foraging_fsm>(
@@ -177,6 +183,24 @@ void stateful_foraging_controller::Init(argos::TConfigurationNode& node) {
 
 void stateful_foraging_controller::process_los(
     const representation::line_of_sight* const los) {
+  const representation::los_delta& delta = los->delta();
+
+  for (auto& c : delta.entered) {
+    los_block_sync(los->cell(c.first, c.second));
+  } /* for(&c..) */
+  for (auto& c : delta.changed) {
+    los_block_sync(los->cell(c.first, c.second));
+  } /* for(&c..) */
+  for (auto& c : delta.unchanged) {
+    los_block_refresh(los->cell(c.first, c.second));
+  } /* for(&c..) */
+} /* process_los() */
+
+void stateful_foraging_controller::los_block_sync(
+    const representation::cell2D& los_cell) {
+  const rcppsw::math::dcoord2& d = los_cell.loc();
+  representation::cell2D& known = m_map->access<occupancy_grid::kCellLayer>(d);
+
   /*
    * If the robot thinks that a cell contains a block, because the cell had one
    * the last time it passed nearby, but when coming near the cell a second time
@@ -184,33 +208,47 @@ void stateful_foraging_controller::process_los(
    * between then and now, and it needs to update its internal representation
    * accordingly.
    */
-  for (size_t i = 0; i < los->xsize(); ++i) {
-    for (size_t j = 0; j < los->ysize(); ++j) {
-      rcppsw::math::dcoord2 d = los->cell(i, j).loc();
-      if (!los->cell(i, j).state_has_block() &&
-          map()->access<occupancy_grid::kCellLayer>(d).state_has_block()) {
-        ER_DIAG("Correct block%d discrepency at (%zu, %zu)",
-                map()->access<occupancy_grid::kCellLayer>(d).block()->id(),
-                d.first,
-                d.second);
-        map()->block_remove(
-            map()->access<occupancy_grid::kCellLayer>(d).block());
-      }
-    } /* for(j..) */
-  }   /* for(i..) */
-
-  for (auto block : los->blocks()) {
-    if (!m_map->access<occupancy_grid::kCellLayer>(block->discrete_loc())
-             .state_has_block()) {
-      ER_NOM("Discovered block%d at (%zu, %zu)",
-             block->id(),
-             block->discrete_loc().first,
-             block->discrete_loc().second);
+  if (!los_cell.state_has_block()) {
+    if (known.state_has_block()) {
+      ER_DIAG("Correct block%d discrepency at (%zu, %zu)",
+              known.block()->id(),
+              d.first,
+              d.second);
+      m_map->block_remove(known.block());
     }
-    events::block_found op(base_foraging_controller::server(), block->clone());
-    m_map->accept(op);
-  } /* for(block..) */
-} /* process_los() */
+    return;
+  }
+
+  if (!known.state_has_block()) {
+    ER_NOM("Discovered block%d at (%zu, %zu)",
+           los_cell.block()->id(),
+           d.first,
+           d.second);
+  }
+  events::block_found op(base_foraging_controller::server(),
+                         los_cell.block()->clone());
+  m_map->accept(op);
+} /* los_block_sync() */
+
+void stateful_foraging_controller::los_block_refresh(
+    const representation::cell2D& los_cell) {
+  if (!los_cell.state_has_block()) {
+    return;
+  }
+  const representation::cell2D& known =
+      m_map->access<occupancy_grid::kCellLayer>(los_cell.loc());
+
+  /*
+   * The robot's map can disagree with an unchanged LOS cell if the block
+   * expired from it, or if the map was reset, so check before short-circuiting.
+   */
+  if (known.state_has_block() &&
+      known.block()->id() == los_cell.block()->id()) {
+    m_map->density_refresh(los_cell.loc());
+  } else {
+    los_block_sync(los_cell);
+  }
+} /* los_block_refresh() */
 
 bool stateful_foraging_controller::is_transporting_to_nest(void) const {
   if (nullptr != current_task()) {
@@ -31,6 +31,7 @@
 #include "fordyca/params/depth0/stateless_foraging_repository.hpp"
 #include "fordyca/params/fsm_params.hpp"
 #include "fordyca/params/sensor_params.hpp"
+#include "fordyca/params/shared_repository.hpp"
 #include "fordyca/representation/line_of_sight.hpp"
 #include "rcppsw/er/server.hpp"
 
@@ -55,15 +56,14 @@ void stateless_foraging_controller::Init(argos::TConfigurationNode& node) {
 
   ER_NOM("Initializing stateless_foraging controller");
 
-  params::depth0::stateless_foraging_repository param_repo;
-  param_repo.parse_all(node);
-  param_repo.show_all(client::server_handle()->log_stream());
-  ER_ASSERT(param_repo.validate_all(),
-            "FATAL: Not all parameters were validated");
+  using repo_type = params::depth0::stateless_foraging_repository;
+  auto* param_repo = params::shared_repository::get<repo_type>(
+      node, client::server_handle()->log_stream());
+  ER_ASSERT(nullptr != param_repo, "FATAL: Not all parameters were validated");
 
   m_fsm = rcppsw::make_unique<fsm::depth0::stateless_foraging_fsm>(
       static_cast<const struct params::fsm_params*>(
-          param_repo.get_params("fsm")),
+          param_repo->get_params("fsm")),
       base_foraging_controller::server(),
       base_foraging_controller::base_sensors_ref(),
       base_foraging_controller::actuators());
@@ -33,13 +33,16 @@
 #include "fordyca/events/cache_found.hpp"
 #include "fordyca/fsm/block_to_nest_fsm.hpp"
 #include "fordyca/fsm/depth0/stateful_foraging_fsm.hpp"
+#include "fordyca/metrics/tick_profiler.hpp"
 #include "fordyca/fsm/depth1/block_to_cache_fsm.hpp"
 #include "fordyca/params/depth0/stateful_foraging_repository.hpp"
 #include "fordyca/params/depth1/task_allocation_params.hpp"
 #include "fordyca/params/depth1/task_repository.hpp"
 #include "fordyca/params/fsm_params.hpp"
 #include "fordyca/params/sensor_params.hpp"
+#include "fordyca/params/shared_repository.hpp"
 #include "fordyca/representation/base_cache.hpp"
+#include "fordyca/representation/line_of_sight.hpp"
 #include "fordyca/representation/perceived_arena_map.hpp"
 #include "fordyca/tasks/collector.hpp"
 #include "fordyca/tasks/generalist.hpp"
@@ -74,8 +77,11 @@ void foraging_controller::ControlStep(void) {
    * the relevance of information (density) within it, and fix any blocks that
    * should be hidden from our awareness.
    */
-  process_los(depth0::stateful_foraging_controller::los());
-  map()->update();
+  {
+    metrics::phase_timer timer(metrics::tick_phase::kPROCESS_LOS);
+    process_los(depth0::stateful_foraging_controller::los());
+  }
+  map()->update(stateful_sensors()->tick());
   m_metric_store.reset();
 
   if (is_carrying_block()) {
@@ -83,32 +89,33 @@ void foraging_controller::ControlStep(void) {
   } else {
     actuators()->set_speed_throttle(false);
   }
+  metrics::phase_timer timer(metrics::tick_phase::kEXECUTIVE_RUN);
   m_executive->run();
 } /* ControlStep() */
 
 void foraging_controller::Init(argos::TConfigurationNode& node) {
-  params::depth1::task_repository task_repo;
-  params::depth0::stateful_foraging_repository fsm_repo;
-
   depth0::stateful_foraging_controller::Init(node);
-  task_repo.parse_all(node);
-  task_repo.show_all(server_handle()->log_stream());
-  fsm_repo.parse_all(node);
-  fsm_repo.show_all(server_handle()->log_stream());
 
-  ER_ASSERT(task_repo.validate_all(),
-            "FATAL: Not all FSM parameters were validated");
-  ER_ASSERT(fsm_repo.validate_all(),
+  /* already parsed by the stateful controller */
+  auto* task_repo =
+      params::shared_repository::get<params::depth1::task_repository>(
+          node, server_handle()->log_stream());
+  auto* fsm_repo = params::shared_repository::get<
+      params::depth0::stateful_foraging_repository>(
+      node, server_handle()->log_stream());
+  ER_ASSERT(nullptr != task_repo,
             "FATAL: Not all task parameters were validated");
+  ER_ASSERT(nullptr != fsm_repo,
+            "FATAL: Not all FSM parameters were validated");
 
   ER_NOM("Initializing depth1 controller");
   const params::depth1::task_allocation_params* p =
       static_cast<const params::depth1::task_allocation_params*>(
-          task_repo.get_params("task_allocation"));
+          task_repo->get_params("task_allocation"));
 
   std::unique_ptr<task_allocation::taskable> collector_fsm =
       rcppsw::make_unique<fsm::block_to_nest_fsm>(
-          static_cast<const params::fsm_params*>(fsm_repo.get_params("fsm")),
+          static_cast<const params::fsm_params*>(fsm_repo->get_params("fsm")),
           base_foraging_controller::server(),
           depth0::stateful_foraging_controller::stateful_sensors_ref(),
           base_foraging_controller::actuators(),
@@ -118,7 +125,7 @@ void foraging_controller::Init(argos::TConfigurationNode& node) {
 
   std::unique_ptr<task_allocation::taskable> harvester_fsm =
       rcppsw::make_unique<fsm::depth1::block_to_cache_fsm>(
-          static_cast<const params::fsm_params*>(fsm_repo.get_params("fsm")),
+          static_cast<const params::fsm_params*>(fsm_repo->get_params("fsm")),
           base_foraging_controller::server(),
           depth0::stateful_foraging_controller::stateful_sensors_ref(),
           base_foraging_controller::actuators(),
@@ -128,7 +135,7 @@ void foraging_controller::Init(argos::TConfigurationNode& node) {
 
   std::unique_ptr<task_allocation::taskable> generalist_fsm =
       rcppsw::make_unique<fsm::depth0::stateful_foraging_fsm>(
-          static_cast<const params::fsm_params*>(fsm_repo.get_params("fsm")),
+          static_cast<const params::fsm_params*>(fsm_repo->get_params("fsm")),
           base_foraging_controller::server(),
           depth0::stateful_foraging_controller::stateful_sensors_ref(),
           base_foraging_controller::actuators(),
@@ -188,6 +195,31 @@ bool foraging_controller::block_acquired(void) const {
 void foraging_controller::process_los(
     const representation::line_of_sight* const c_los) {
   depth0::stateful_foraging_controller::process_los(c_los);
+  const representation::los_delta& delta = c_los->delta();
+
+  for (auto& c : delta.entered) {
+    los_cache_sync(c_los->cell(c.first, c.second));
+  } /* for(&c..) */
+  for (auto& c : delta.changed) {
+    los_cache_sync(c_los->cell(c.first, c.second));
+  } /* for(&c..) */
+  for (auto& c : delta.unchanged) {
+    los_cache_refresh(c_los->cell(c.first, c.second));
+  } /* for(&c..) */
+
+  /*
+   * Caches whose host cell is not in the LOS are not tracked by the delta, so
+   * they are always processed.
+   */
+  for (auto& cache : c_los->extra_caches()) {
+    cache_discover(cache);
+  } /* for(&cache..) */
+} /* process_los() */
+
+void foraging_controller::los_cache_sync(
+    const representation::cell2D& los_cell) {
+  const rcppsw::math::dcoord2& d = los_cell.loc();
+  representation::cell2D& known = map()->access<occupancy_grid::kCellLayer>(d);
 
   /*
    * If the robot thinks that a cell contains a cache, because the cell had one
@@ -195,52 +227,71 @@ void foraging_controller::process_los(
    * the cell does not contain a cache, then the cache was depleted between then
    * and now, and it needs to update its internal representation accordingly.
    */
-  for (size_t i = 0; i < c_los->xsize(); ++i) {
-    for (size_t j = 0; j < c_los->ysize(); ++j) {
-      rcppsw::math::dcoord2 d = c_los->cell(i, j).loc();
-      if (!c_los->cell(i, j).state_has_cache() &&
-          map()->access<occupancy_grid::kCellLayer>(d).state_has_cache()) {
-        ER_DIAG("Correct cache%d discrepency at (%zu, %zu)",
-                map()->access<occupancy_grid::kCellLayer>(d).cache()->id(),
-                d.first,
-                d.second);
-        map()->cache_remove(
-            map()->access<occupancy_grid::kCellLayer>(d).cache());
-      }
-    } /* for(j..) */
-  }   /* for(i..) */
-
-  for (auto cache : c_los->caches()) {
-    /*
-     * The state of a cache can change between when the robot saw it last
-     * (i.e. different # of blocks in it), and so you need to always process
-     * caches in the LOS, even if you already know about them.
-     */
-    if (!map()
-             ->access<occupancy_grid::kCellLayer>(cache->discrete_loc())
-             .state_has_cache()) {
-      ER_NOM("Discovered cache%d at (%zu, %zu): %u blocks",
-             cache->id(),
-             cache->discrete_loc().first,
-             cache->discrete_loc().second,
-             cache->n_blocks());
+  if (!los_cell.state_has_cache()) {
+    if (known.state_has_cache()) {
+      ER_DIAG("Correct cache%d discrepency at (%zu, %zu)",
+              known.cache()->id(),
+              d.first,
+              d.second);
+      map()->cache_remove(known.cache());
     }
-    /*
-     * The cache we get a handle to is owned by the simulation, and we don't
-     * want to just pass that into the robot's arena_map, as keeping them in
-     * sync is not possible in all situations.
-     *
-     * For example, if a block executing the collector task picks up a block and
-     * tries to compute the best cache to bring it to, only to have one or more
-     * of its cache references be invalid due to other robots causing caches to
-     * be created/destroyed.
-     *
-     * Cloning is definitely necessary here.
-     */
-    events::cache_found op(base_foraging_controller::server(), cache->clone());
-    map()->accept(op);
-  } /* for(cache..) */
-} /* process_los() */
+    return;
+  }
+  /*
+   * The state of a cache can change between when the robot saw it last
+   * (i.e. different # of blocks in it), which shows up as a changed cell.
+   */
+  cache_discover(los_cell.cache());
+} /* los_cache_sync() */
+
+void foraging_controller::los_cache_refresh(
+    const representation::cell2D& los_cell) {
+  if (!los_cell.state_has_cache()) {
+    return;
+  }
+  const representation::cell2D& known =
+      map()->access<occupancy_grid::kCellLayer>(los_cell.loc());
+
+  /*
+   * The robot can disagree with an unchanged LOS cell if its map was reset, or
+   * if it has modified its own copy of the cache, so check before
+   * short-circuiting.
+   */
+  if (known.state_has_cache() &&
+      known.cache()->id() == los_cell.cache()->id() &&
+      known.cache()->n_blocks() == los_cell.cache()->n_blocks()) {
+    map()->density_refresh(los_cell.loc());
+  } else {
+    los_cache_sync(los_cell);
+  }
+} /* los_cache_refresh() */
+
+void foraging_controller::cache_discover(
+    const std::shared_ptr<const representation::base_cache>& cache) {
+  if (!map()
+           ->access<occupancy_grid::kCellLayer>(cache->discrete_loc())
+           .state_has_cache()) {
+    ER_NOM("Discovered cache%d at (%zu, %zu): %u blocks",
+           cache->id(),
+           cache->discrete_loc().first,
+           cache->discrete_loc().second,
+           cache->n_blocks());
+  }
+  /*
+   * The cache we get a handle to is owned by the simulation, and we don't
+   * want to just pass that into the robot's arena_map, as keeping them in
+   * sync is not possible in all situations.
+   *
+   * For example, if a block executing the collector task picks up a block and
+   * tries to compute the best cache to bring it to, only to have one or more
+   * of its cache references be invalid due to other robots causing caches to
+   * be created/destroyed.
+   *
+   * Cloning is definitely necessary here.
+   */
+  events::cache_found op(base_foraging_controller::server(), cache->clone());
+  map()->accept(op);
+} /* cache_discover() */
 
 bool foraging_controller::is_transporting_to_nest(void) const {
   if (nullptr != current_task()) {
@@ -24,6 +24,7 @@
 #include "fordyca/events/block_found.hpp"
 #include "fordyca/controller/depth0/stateful_foraging_controller.hpp"
 #include "fordyca/controller/depth1/foraging_controller.hpp"
+#include "fordyca/events/er_module.hpp"
 #include "fordyca/representation/block.hpp"
 #include "fordyca/representation/perceived_arena_map.hpp"
 #include "rcppsw/swarm/pheromone_density.hpp"
@@ -42,14 +43,8 @@ block_found::block_found(const std::shared_ptr<rcppsw::er::server>& server,
                          std::unique_ptr<representation::block> block)
     : perceived_cell_op(block->discrete_loc().first,
                         block->discrete_loc().second),
-      client(server),
-      m_block(std::move(block)) {
-  client::insmod("block_found",
-                 rcppsw::er::er_lvl::DIAG,
-                 rcppsw::er::er_lvl::NOM);
-}
-
-block_found::~block_found(void) { client::rmmod(); }
+      client(er_module<block_found>(server, "block_found")),
+      m_block(std::move(block)) {}
 
 /*******************************************************************************
  * Depth0 Foraging
@@ -61,22 +56,15 @@ void block_found::visit(representation::cell2D& cell) {
 } /* visit() */
 
 void block_found::visit(fsm::cell2D_fsm& fsm) {
-  if (fsm.state_has_cache()) {
-    for (size_t i = fsm.block_count(); i > 1; --i) {
-      fsm.event_block_pickup();
-    } /* for(i..) */
-  } else if (!fsm.state_has_block()) {
-    fsm.event_block_drop();
-  }
-  ER_ASSERT(fsm.state_has_block(),
+  bool legal = fsm.event_block_count(1);
+  ER_ASSERT(legal && fsm.state_has_block(),
             "FATAL: Perceived cell in incorrect state after block found event");
 } /* visit() */
 
 void block_found::visit(representation::perceived_arena_map& map) {
   representation::cell2D& cell =
       map.access<occupancy_grid::kCellLayer>(cell_op::x(), cell_op::y());
-  swarm::pheromone_density& density =
-      map.access<occupancy_grid::kPheromoneLayer>(cell_op::x(), cell_op::y());
+  swarm::pheromone_density& density = map.density(cell_op::x(), cell_op::y());
 
   /*
    * If the cell is currently in a HAS_CACHE state, then that means that this
@@ -112,6 +100,7 @@ void block_found::visit(representation::perceived_arena_map& map) {
       density.pheromone_set(1.0);
     }
   }
+  map.known_cell_add(cell_op::x(), cell_op::y());
   /*
    * ONLY if we actually added a block the list of known blocks do we update
    * what block the cell points to. If we do it unconditionally, we are left
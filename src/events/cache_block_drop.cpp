@@ -23,6 +23,7 @@
  ******************************************************************************/
 #include "fordyca/events/cache_block_drop.hpp"
 #include "fordyca/controller/depth1/foraging_controller.hpp"
+#include "fordyca/events/er_module.hpp"
 #include "fordyca/events/free_block_drop.hpp"
 #include "fordyca/fsm/block_to_nest_fsm.hpp"
 #include "fordyca/fsm/depth1/block_to_cache_fsm.hpp"
@@ -50,15 +51,11 @@ cache_block_drop::cache_block_drop(
     const std::shared_ptr<representation::arena_cache>& cache,
     double resolution)
     : cell_op(cache->discrete_loc().first, cache->discrete_loc().second),
-      client(server),
+      client(er_module<cache_block_drop>(server, "cache_block_drop")),
       m_resolution(resolution),
       m_block(block),
       m_cache(cache),
-      m_server(server) {
-  client::insmod("cache_block_drop",
-                 rcppsw::er::er_lvl::DIAG,
-                 rcppsw::er::er_lvl::NOM);
-}
+      m_server(server) {}
 
 /*******************************************************************************
  * Depth1 Foraging
@@ -76,7 +73,11 @@ void cache_block_drop::visit(representation::cell2D& cell) {
 
 void cache_block_drop::visit(fsm::cell2D_fsm& fsm) {
   ER_ASSERT(fsm.state_has_cache(), "FATAL: cell does not contain a cache");
-  fsm.event_block_drop();
+  bool legal = fsm.event_block_drop();
+  ER_ASSERT(legal,
+            "FATAL: Too many blocks in cache cell (%zu, %zu)",
+            cell_op::x(),
+            cell_op::y());
 } /* visit() */
 
 void cache_block_drop::visit(representation::arena_map& map) {
@@ -85,6 +86,7 @@ void cache_block_drop::visit(representation::arena_map& map) {
   m_block->accept(*this);
   m_cache->accept(*this);
   map.access(cell_op::x(), cell_op::y()).accept(*this);
+  map.cell_changed(rcppsw::math::dcoord2(cell_op::x(), cell_op::y()));
   ER_NOM("arena_map: fb%d dropped block%d in cache%d [%u blocks total]",
          index,
          m_block->id(),
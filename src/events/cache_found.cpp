@@ -23,7 +23,7 @@
  ******************************************************************************/
 #include "fordyca/events/cache_found.hpp"
 #include "fordyca/controller/depth1/foraging_controller.hpp"
-#include "fordyca/events/cell_empty.hpp"
+#include "fordyca/events/er_module.hpp"
 #include "fordyca/representation/base_cache.hpp"
 #include "fordyca/representation/perceived_arena_map.hpp"
 
@@ -42,14 +42,8 @@ cache_found::cache_found(const std::shared_ptr<rcppsw::er::server>& server,
                          std::unique_ptr<representation::base_cache> cache)
     : perceived_cell_op(cache->discrete_loc().first,
                         cache->discrete_loc().second),
-      client(server),
-      m_cache(std::move(cache)) {
-  client::insmod("cache_found",
-                 rcppsw::er::er_lvl::DIAG,
-                 rcppsw::er::er_lvl::NOM);
-}
-
-cache_found::~cache_found(void) { client::rmmod(); }
+      client(er_module<cache_found>(server, "cache_found")),
+      m_cache(std::move(cache)) {}
 
 /*******************************************************************************
  * Depth1 Foraging
@@ -78,26 +72,22 @@ void cache_found::visit(fsm::cell2D_fsm& fsm) {
    * after the cell that refers to it is update (this class does said update)).
    *
    * As such, we need to make sure that we ALWAYS put the cell in the correct
-   * state by sending it enough block drops. (see #323).
+   * state by setting the block count directly, rather than replaying the
+   * difference as block drops/pickups (see #323).
    */
-  for (size_t i = fsm.block_count();
-       i < std::max(base_cache::kMinBlocks, m_cache->n_blocks());
-       ++i) {
-    fsm.event_block_drop();
-  } /* for(i..) */
-
-  for (size_t i = fsm.block_count();
-       i > std::max(base_cache::kMinBlocks, m_cache->n_blocks());
-       --i) {
-    fsm.event_block_pickup();
-  } /* for(i..) */
+  size_t count = std::max(base_cache::kMinBlocks, m_cache->n_blocks());
+  bool legal = fsm.event_block_count(count);
+  ER_ASSERT(legal,
+            "FATAL: Too many blocks (%zu) in cache cell (%zu, %zu)",
+            count,
+            cell_op::x(),
+            cell_op::y());
 } /* visit() */
 
 void cache_found::visit(representation::perceived_arena_map& map) {
   representation::cell2D& cell =
       map.access<occupancy_grid::kCellLayer>(cell_op::x(), cell_op::y());
-  swarm::pheromone_density& density =
-      map.access<occupancy_grid::kPheromoneLayer>(cell_op::x(), cell_op::y());
+  swarm::pheromone_density& density = map.density(cell_op::x(), cell_op::y());
   /**
    * Remove any and all blocks from the known blocks list that exist in
    * the same space that a cache occupies.
@@ -117,10 +107,10 @@ void cache_found::visit(representation::perceived_arena_map& map) {
     if (m_cache->contains_point((*it)->real_loc())) {
       ER_VER("Remove block%d hidden behind cache%d", (*it)->id(), m_cache->id());
 
-      events::cell_empty op((*it)->discrete_loc().first,
-                            (*it)->discrete_loc().second);
-      map.access<occupancy_grid::kCellLayer>((*it)->discrete_loc()).accept(op);
-      it = map.blocks().erase(it);
+      /* advance first: removal invalidates the iterator to the victim */
+      std::shared_ptr<representation::block> victim = *it;
+      ++it;
+      map.block_remove(victim);
     } else {
       ++it;
     }
@@ -160,6 +150,7 @@ void cache_found::visit(representation::perceived_arena_map& map) {
       density.pheromone_set(1.0);
     }
   }
+  map.known_cell_add(cell_op::x(), cell_op::y());
   map.cache_add(m_cache);
   cell.accept(*this);
 } /* visit() */
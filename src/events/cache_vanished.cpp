@@ -23,6 +23,7 @@
  ******************************************************************************/
 #include "fordyca/events/cache_vanished.hpp"
 #include "fordyca/controller/depth1/foraging_controller.hpp"
+#include "fordyca/events/er_module.hpp"
 #include "fordyca/fsm/block_to_nest_fsm.hpp"
 #include "fordyca/fsm/depth1/block_to_cache_fsm.hpp"
 
@@ -39,11 +40,8 @@ NS_START(fordyca, events);
  ******************************************************************************/
 cache_vanished::cache_vanished(const std::shared_ptr<rcppsw::er::server>& server,
                                uint cache_id)
-    : client(server), m_cache_id(cache_id) {
-  client::insmod("cache_vanished",
-                 rcppsw::er::er_lvl::DIAG,
-                 rcppsw::er::er_lvl::NOM);
-}
+    : client(er_module<cache_vanished>(server, "cache_vanished")),
+      m_cache_id(cache_id) {}
 
 /*******************************************************************************
  * Depth1 Foraging
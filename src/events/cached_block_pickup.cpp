@@ -25,6 +25,7 @@
 #include "fordyca/controller/depth1/foraging_controller.hpp"
 #include "fordyca/events/cache_found.hpp"
 #include "fordyca/events/cell_empty.hpp"
+#include "fordyca/events/er_module.hpp"
 #include "fordyca/fsm/block_to_nest_fsm.hpp"
 #include "fordyca/fsm/cell2D_fsm.hpp"
 #include "fordyca/fsm/depth0/stateful_foraging_fsm.hpp"
@@ -51,13 +52,10 @@ cached_block_pickup::cached_block_pickup(
     const std::shared_ptr<representation::arena_cache>& cache,
     size_t robot_index)
     : cell_op(cache->discrete_loc().first, cache->discrete_loc().second),
-      client(server),
+      client(er_module<cached_block_pickup>(server, "cached_block_pickup")),
       m_robot_index(robot_index),
       m_real_cache(cache),
       m_server(server) {
-  client::insmod("cached_block_pickup",
-                 rcppsw::er::er_lvl::DIAG,
-                 rcppsw::er::er_lvl::NOM);
   ER_ASSERT(m_real_cache->n_blocks() >= 2, "FATAL: < 2 blocks in cache");
   m_pickup_block = m_real_cache->block_get();
   ER_ASSERT(m_pickup_block, "FATAL: No block in non-empty cache");
@@ -67,7 +65,11 @@ cached_block_pickup::cached_block_pickup(
  * Depth1 Foraging
  ******************************************************************************/
 void cached_block_pickup::visit(fsm::cell2D_fsm& fsm) {
-  fsm.event_block_pickup();
+  bool legal = fsm.event_block_pickup();
+  ER_ASSERT(legal,
+            "FATAL: Block pickup from cell (%zu, %zu) without a cache",
+            cell_op::x(),
+            cell_op::y());
 } /* visit() */
 
 void cached_block_pickup::visit(representation::cell2D& cell) {
@@ -50,7 +50,7 @@ void cell_empty::visit(representation::arena_map& map) {
 } /* visit() */
 
 void cell_empty::visit(representation::perceived_arena_map& map) {
-  map.access<occupancy_grid::kPheromoneLayer>(x(), y()).reset();
+  map.density(x(), y()).reset();
   map.access<occupancy_grid::kCellLayer>(x(), y()).accept(*this);
 } /* visit() */
 
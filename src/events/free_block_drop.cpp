@@ -25,6 +25,7 @@
 #include <argos3/core/utility/math/vector2.h>
 
 #include "fordyca/events/cache_block_drop.hpp"
+#include "fordyca/events/er_module.hpp"
 #include "fordyca/metrics/block_metrics_collector.hpp"
 #include "fordyca/representation/arena_map.hpp"
 #include "fordyca/representation/block.hpp"
@@ -45,14 +46,10 @@ free_block_drop::free_block_drop(
     size_t y,
     double resolution)
     : cell_op(x, y),
-      client(server),
+      client(er_module<free_block_drop>(server, "free_block_drop")),
       m_resolution(resolution),
       m_block(block),
-      m_server(server) {
-  client::insmod("free_block_drop",
-                 rcppsw::er::er_lvl::DIAG,
-                 rcppsw::er::er_lvl::NOM);
-}
+      m_server(server) {}
 
 /*******************************************************************************
  * Foraging Support
@@ -64,7 +61,11 @@ void free_block_drop::visit(representation::cell2D& cell) {
 } /* visit() */
 
 void free_block_drop::visit(fsm::cell2D_fsm& fsm) {
-  fsm.event_block_drop();
+  bool legal = fsm.event_block_drop();
+  ER_ASSERT(legal,
+            "FATAL: Too many blocks in cell (%zu, %zu)",
+            cell_op::x(),
+            cell_op::y());
 } /* visit() */
 
 void free_block_drop::visit(representation::block& block) {
@@ -99,6 +100,7 @@ void free_block_drop::visit(representation::arena_map& map) {
     map.distribute_block(m_block);
   } else {
     cell.accept(*this);
+    map.cell_changed(rcppsw::math::dcoord2(cell_op::x(), cell_op::y()));
   }
 } /* visit() */
 
@@ -26,6 +26,7 @@
 #include "fordyca/controller/depth0/stateless_foraging_controller.hpp"
 #include "fordyca/controller/depth1/foraging_controller.hpp"
 #include "fordyca/events/cell_empty.hpp"
+#include "fordyca/events/er_module.hpp"
 #include "fordyca/fsm/depth0/stateful_foraging_fsm.hpp"
 #include "fordyca/fsm/depth0/stateless_foraging_fsm.hpp"
 #include "fordyca/fsm/depth1/block_to_cache_fsm.hpp"
@@ -51,20 +52,20 @@ free_block_pickup::free_block_pickup(
     const std::shared_ptr<representation::block>& block,
     uint robot_index)
     : cell_op(block->discrete_loc().first, block->discrete_loc().second),
-      client(server),
+      client(er_module<free_block_pickup>(server, "free_block_pickup")),
       m_robot_index(robot_index),
       m_block(block),
-      m_server(server) {
-  client::insmod("free_block_pickup",
-                 rcppsw::er::er_lvl::DIAG,
-                 rcppsw::er::er_lvl::NOM);
-}
+      m_server(server) {}
 
 /*******************************************************************************
  * Foraging Support
  ******************************************************************************/
 void free_block_pickup::visit(fsm::cell2D_fsm& fsm) {
-  fsm.event_block_pickup();
+  bool legal = fsm.event_block_pickup();
+  ER_ASSERT(legal,
+            "FATAL: Block pickup from cell (%zu, %zu) without a block",
+            cell_op::x(),
+            cell_op::y());
 } /* visit() */
 
 void free_block_pickup::visit(representation::cell2D& cell) {
@@ -85,6 +86,7 @@ void free_block_pickup::visit(representation::arena_map& map) {
   events::cell_empty op(cell_op::x(), cell_op::y());
   map.accept(op);
   m_block->accept(*this);
+  map.cell_changed(rcppsw::math::dcoord2(cell_op::x(), cell_op::y()));
   ER_NOM("arena_map: fb%u: block%d from (%f, %f) -> (%zu, %zu)",
          m_robot_index,
          m_block->id(),
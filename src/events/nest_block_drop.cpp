@@ -25,6 +25,7 @@
 #include "fordyca/controller/depth0/stateful_foraging_controller.hpp"
 #include "fordyca/controller/depth0/stateless_foraging_controller.hpp"
 #include "fordyca/controller/depth1/foraging_controller.hpp"
+#include "fordyca/events/er_module.hpp"
 #include "fordyca/fsm/depth0/stateful_foraging_fsm.hpp"
 #include "fordyca/fsm/depth0/stateless_foraging_fsm.hpp"
 #include "fordyca/metrics/block_metrics_collector.hpp"
@@ -46,11 +47,8 @@ NS_START(fordyca, events);
 nest_block_drop::nest_block_drop(
     const std::shared_ptr<rcppsw::er::server>& server,
     const std::shared_ptr<representation::block>& block)
-    : client(server), m_block(block) {
-  client::insmod("nest_block_drop",
-                 rcppsw::er::er_lvl::DIAG,
-                 rcppsw::er::er_lvl::NOM);
-}
+    : client(er_module<nest_block_drop>(server, "nest_block_drop")),
+      m_block(block) {}
 
 /*******************************************************************************
  * Foraging Support
@@ -28,133 +28,82 @@
 NS_START(fordyca, fsm);
 
 /*******************************************************************************
- * Constructors/Destructor
+ * Global Variables
  ******************************************************************************/
-cell2D_fsm::cell2D_fsm(const std::shared_ptr<rcppsw::er::server>& server)
-    : state_machine::simple_fsm(server, ST_MAX_STATES, ST_UNKNOWN),
-      state_unknown(),
-      state_empty(),
-      state_block(),
-      state_cache(),
-      m_block_count(0) {
-  /* if (ERROR == attmod("cell2D_fsm")) { */
-  /*   client::insmod("cell2D_fsm", */
-  /*                     rcppsw::er::er_lvl::NOM, */
-  /*                     rcppsw::er::er_lvl::NOM); */
-  /* } */
-}
+constexpr size_t cell2D_fsm::kMAX_BLOCK_COUNT;
 
-cell2D_fsm::cell2D_fsm(void)
-    : state_machine::simple_fsm(ST_MAX_STATES, ST_UNKNOWN),
-      state_unknown(),
-      state_empty(),
-      state_block(),
-      state_cache(),
-      m_block_count(0) {
-  /* if (ERROR == attmod("cell2D_fsm")) { */
-  /*   client::insmod("cell2D_fsm", */
-  /*                     rcppsw::er::er_lvl::NOM, */
-  /*                     rcppsw::er::er_lvl::NOM); */
-  /* } */
-}
-
-/*******************************************************************************
- * Event Functions
- ******************************************************************************/
-void cell2D_fsm::event_unknown(void) {
-  FSM_DEFINE_TRANSITION_MAP(kTRANSITIONS){
-      ST_UNKNOWN, /* unknown */
-      ST_UNKNOWN, /* empty */
-      ST_UNKNOWN, /* has block */
-      ST_UNKNOWN  /* has cache */
-  };
-  FSM_VERIFY_TRANSITION_MAP(kTRANSITIONS, ST_MAX_STATES);
-  external_event(kTRANSITIONS[current_state()], nullptr);
-} /* event_unknown() */
-
-void cell2D_fsm::event_empty(void) {
-  FSM_DEFINE_TRANSITION_MAP(kTRANSITIONS){
-      ST_EMPTY, /* unknown */
-      ST_EMPTY, /* empty */
-      ST_EMPTY, /* has block */
-      ST_EMPTY, /* has cache */
-  };
-  FSM_VERIFY_TRANSITION_MAP(kTRANSITIONS, ST_MAX_STATES);
-  external_event(kTRANSITIONS[current_state()], nullptr);
-} /* event_empty() */
-
-void cell2D_fsm::event_block_drop(void) {
-  FSM_DEFINE_TRANSITION_MAP(kTRANSITIONS){
-      ST_HAS_BLOCK, /* unknown */
-      ST_HAS_BLOCK, /* empty */
-      ST_HAS_CACHE, /* has block */
-      ST_HAS_CACHE  /* has cache */
-  };
-  FSM_VERIFY_TRANSITION_MAP(kTRANSITIONS, ST_MAX_STATES);
-  external_event(kTRANSITIONS[current_state()],
-                 rcppsw::make_unique<block_data>(false));
-} /* event_empty() */
-
-void cell2D_fsm::event_block_pickup(void) {
-  FSM_DEFINE_TRANSITION_MAP(kTRANSITIONS){
-      state_machine::event_signal::FATAL, /* unknown */
-      state_machine::event_signal::FATAL, /* empty */
-      ST_EMPTY,                           /* has block */
-      ST_HAS_CACHE                        /* has cache */
-  };
-  FSM_VERIFY_TRANSITION_MAP(kTRANSITIONS, ST_MAX_STATES);
-  external_event(kTRANSITIONS[current_state()],
-                 rcppsw::make_unique<block_data>(true));
-} /* event_block_drop() */
+/*
+ * Indexed by [event][current state]. The HAS_CACHE -> HAS_BLOCK transition
+ * when the 2nd to last block is picked up from a cache is not in the table, as
+ * it depends on the block count (see \ref transition()).
+ */
+const cell2D_fsm::transition_entry
+    cell2D_fsm::kTRANSITIONS[EV_MAX_EVENTS][ST_MAX_STATES] = {
+        /* unknown */
+        {
+            {ST_UNKNOWN, 0, true}, /* unknown */
+            {ST_UNKNOWN, 0, true}, /* empty */
+            {ST_UNKNOWN, 0, true}, /* has block */
+            {ST_UNKNOWN, 0, true}  /* has cache */
+        },
+        /* empty */
+        {
+            {ST_EMPTY, 0, true}, /* unknown */
+            {ST_EMPTY, 0, true}, /* empty */
+            {ST_EMPTY, 0, true}, /* has block */
+            {ST_EMPTY, 0, true}  /* has cache */
+        },
+        /* block drop */
+        {
+            {ST_HAS_BLOCK, 1, true},  /* unknown */
+            {ST_HAS_BLOCK, 1, true},  /* empty */
+            {ST_HAS_CACHE, 1, false}, /* has block */
+            {ST_HAS_CACHE, 1, false}  /* has cache */
+        },
+        /* block pickup */
+        {
+            {kFATAL, 0, false},        /* unknown */
+            {kFATAL, 0, false},        /* empty */
+            {ST_EMPTY, 0, true},       /* has block */
+            {ST_HAS_CACHE, -1, false}  /* has cache */
+        },
+};
 
 /*******************************************************************************
- * State Functions
+ * Member Functions
  ******************************************************************************/
-FSM_STATE_DEFINE_ND(cell2D_fsm, state_unknown) {
-  if (ST_UNKNOWN != last_state()) {
-    ER_DIAG("Cell in UNKNOWN state.");
-    m_block_count = 0;
+bool cell2D_fsm::transition(event ev) {
+  const transition_entry& t = kTRANSITIONS[ev][current_state()];
+  if (kFATAL == t.next) {
+    return false;
   }
-  return state_machine::event_signal::HANDLED;
-}
-FSM_STATE_DEFINE_ND(cell2D_fsm, state_empty) {
-  if (ST_EMPTY != last_state()) {
-    ER_DIAG("Cell in EMPTY state.");
-    m_block_count = 0;
+  size_t count = (t.count_reset) ? 0 : m_block_count;
+  if (t.count_delta > 0 && count >= kMAX_BLOCK_COUNT) {
+    return false;
   }
-  return state_machine::event_signal::HANDLED;
-}
+  m_block_count = static_cast<uint32_t>(count + t.count_delta);
+  m_state = t.next;
 
-FSM_STATE_DEFINE_ND(cell2D_fsm, state_block) {
-  if (ST_HAS_BLOCK != last_state()) {
-    m_block_count = 1;
-    ER_DIAG("Cell HAS_BLOCK.");
+  /* A cache with only one block left in it is just a block */
+  if (ST_HAS_CACHE == m_state && 1 == m_block_count) {
+    m_state = ST_HAS_BLOCK;
   }
-  return state_machine::event_signal::HANDLED;
-}
+  return true;
+} /* transition() */
 
-FSM_STATE_DEFINE(cell2D_fsm, state_cache, struct block_data) {
-  if (ST_HAS_CACHE != last_state()) {
-    ER_DIAG("Cell HAS_CACHE.");
-    ER_ASSERT(1 == m_block_count,
-              "FATAL: block count should be 1 on transition to HAS_CACHE");
-  }
-  if (nullptr != data) {
-    if (data->pickup) {
-      --m_block_count;
-    } else {
-      ++m_block_count;
-    }
+bool cell2D_fsm::event_block_count(size_t n) {
+  if (n > kMAX_BLOCK_COUNT) {
+    return false;
   }
-  if (1 == m_block_count) {
-    internal_event(ST_HAS_BLOCK);
+  m_block_count = static_cast<uint32_t>(n);
+  if (0 == n) {
+    m_state = ST_EMPTY;
+  } else if (1 == n) {
+    m_state = ST_HAS_BLOCK;
+  } else {
+    m_state = ST_HAS_CACHE;
   }
-  return state_machine::event_signal::HANDLED;
-}
-
-/*******************************************************************************
- * Member Functions
- ******************************************************************************/
-void cell2D_fsm::init(void) { state_machine::simple_fsm::init(); } /* init() */
+  return true;
+} /* event_block_count() */
 
 NS_END(fsm, fordyca);
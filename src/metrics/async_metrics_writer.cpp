@@ -0,0 +1,117 @@
+/**
+ * @file async_metrics_writer.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/metrics/async_metrics_writer.hpp"
+#include <algorithm>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+async_metrics_writer::async_metrics_writer(size_t depth)
+    : m_slots(std::max(depth, static_cast<size_t>(1))) {
+  m_thread = std::thread(&async_metrics_writer::thread_main, this);
+}
+
+async_metrics_writer::~async_metrics_writer(void) {
+  drain();
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_stop = true;
+  }
+  m_not_empty.notify_one();
+  m_thread.join();
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void async_metrics_writer::enqueue(row_writer* writer, const metrics_row& row) {
+  std::unique_lock<std::mutex> lock(m_mtx);
+  m_not_full.wait(lock, [&]() { return m_count < m_slots.size(); });
+
+  /*
+   * Copy assignment reuses the storage of the row that was last in this slot.
+   */
+  slot& s = m_slots[(m_head + m_count) % m_slots.size()];
+  s.writer = writer;
+  s.row = row;
+  ++m_count;
+  lock.unlock();
+  m_not_empty.notify_one();
+} /* enqueue() */
+
+void async_metrics_writer::drain(void) {
+  std::unique_lock<std::mutex> lock(m_mtx);
+  m_flush = true;
+  m_not_empty.notify_one();
+  m_idle.wait(lock, [&]() { return 0 == m_count && !m_busy && !m_flush; });
+} /* drain() */
+
+void async_metrics_writer::thread_main(void) {
+  std::unique_lock<std::mutex> lock(m_mtx);
+  while (true) {
+    m_not_empty.wait(lock,
+                     [&]() { return m_count > 0 || m_flush || m_stop; });
+    if (m_count > 0) {
+      /*
+       * The slot is not released until the row has been written, so the
+       * producer cannot overwrite it while we are writing it unlocked.
+       */
+      slot& s = m_slots[m_head];
+      m_busy = true;
+      lock.unlock();
+      s.writer->row_write(s.row);
+      lock.lock();
+
+      if (m_dirty.end() ==
+          std::find(m_dirty.begin(), m_dirty.end(), s.writer)) {
+        m_dirty.push_back(s.writer);
+      }
+      m_head = (m_head + 1) % m_slots.size();
+      --m_count;
+      m_not_full.notify_one();
+    } else if (m_flush) {
+      /* flush every writer used since the last drain */
+      m_flushing.swap(m_dirty);
+      m_busy = true;
+      lock.unlock();
+      for (auto* w : m_flushing) {
+        w->flush();
+      } /* for(*w..) */
+      lock.lock();
+      m_flushing.clear();
+      m_flush = false;
+    } else {
+      return; /* stopping, and nothing left to write */
+    }
+    m_busy = false;
+    m_idle.notify_all();
+  } /* while() */
+} /* thread_main() */
+
+NS_END(metrics, fordyca);
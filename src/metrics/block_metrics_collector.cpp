@@ -34,24 +34,21 @@ NS_START(fordyca, metrics);
  ******************************************************************************/
 block_metrics_collector::block_metrics_collector(const std::string& ofname,
                                                  uint interval)
-    : base_metrics_collector(ofname, interval), m_metrics() {}
+    : typed_metrics_collector(ofname, interval), m_metrics() {}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-std::string block_metrics_collector::csv_header_build(const std::string& header) {
-  // clang-format off
-  return base_metrics_collector::csv_header_build(header) +
-      "block_carries" + separator();
-  // clang-format on
-} /* csv_header_build() */
+column_schema block_metrics_collector::columns(void) const {
+  return {{"block_carries", column_type::kDOUBLE}};
+} /* columns() */
 
 void block_metrics_collector::reset(void) {
-  base_metrics_collector::reset();
+  typed_metrics_collector::reset();
   m_metrics = {0, 0};
 } /* reset() */
 
-bool block_metrics_collector::csv_line_build(std::string& line) {
+bool block_metrics_collector::row_build(metrics_row& row) {
   double avg_carries = 0;
   if (!((timestep() + 1) % interval() == 0)) {
     return false;
@@ -61,10 +58,9 @@ bool block_metrics_collector::csv_line_build(std::string& line) {
     avg_carries =
         static_cast<double>(m_metrics.cum_carries) / m_metrics.cum_collected;
   }
-  line = std::to_string(avg_carries) + separator() +
-         std::to_string(m_metrics.cum_collected) + separator();
+  row.double_add(avg_carries);
   return true;
-} /* csv_line_build() */
+} /* row_build() */
 
 void block_metrics_collector::collect(
     const rcppsw::metrics::base_metrics& metrics) {
@@ -34,61 +34,48 @@ NS_START(fordyca, metrics);
  ******************************************************************************/
 cache_metrics_collector::cache_metrics_collector(const std::string& ofname,
                                                  uint interval)
-    : base_metrics_collector(ofname, interval), m_stats(), m_cache_ids() {}
+    : typed_metrics_collector(ofname, interval), m_stats(), m_cache_ids() {}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-std::string cache_metrics_collector::csv_header_build(const std::string& header) {
-  // clang-format off
-  return base_metrics_collector::csv_header_build(header) +
-      "avg_blocks" + separator() +
-      "avg_pickups" + separator() +
-      "avg_drops"  + separator() +
-      "avg_penalty"  + separator();
-  // clang-format on
-} /* csv_header_build() */
+column_schema cache_metrics_collector::columns(void) const {
+  return {{"avg_blocks", column_type::kDOUBLE},
+          {"avg_pickups", column_type::kDOUBLE},
+          {"avg_drops", column_type::kDOUBLE},
+          {"avg_penalty", column_type::kDOUBLE}};
+} /* columns() */
 
 void cache_metrics_collector::reset(void) {
-  base_metrics_collector::reset();
+  typed_metrics_collector::reset();
   reset_after_interval();
 } /* reset() */
 
-bool cache_metrics_collector::csv_line_build(std::string& line) {
+bool cache_metrics_collector::row_build(metrics_row& row) {
   if (!((timestep() + 1) % interval() == 0)) {
     return false;
   }
+  if (m_cache_ids.empty()) {
+    row.double_add(0);
+    row.double_add(0);
+    row.double_add(0);
+    row.double_add(0);
+    return true;
+  }
+
   /*
    * Because # blocks is always non-zero and collected every timestep, we need
    * to account for that in the avg # blocks across all caches. This is not
    * necessary for the rest of the reported metrics.
    */
-  line += (!m_cache_ids.empty())
-              ? std::to_string(static_cast<double>(m_stats.n_blocks) /
-                               (m_cache_ids.size() * interval()))
-              : "0";
-  line += separator();
-
-  line += (!m_cache_ids.empty())
-              ? std::to_string(static_cast<double>(m_stats.n_pickups) /
-                               (m_cache_ids.size()))
-              : "0";
-  line += separator();
-
-  line += (!m_cache_ids.empty())
-              ? std::to_string(static_cast<double>(m_stats.n_drops) /
-                               (m_cache_ids.size()))
-              : "0";
-  line += separator();
-
-  line += (!m_cache_ids.empty())
-              ? std::to_string(static_cast<double>(m_stats.n_penalty_steps) /
-                               (m_penalty_count))
-              : "0";
-  line += separator();
-
+  row.double_add(static_cast<double>(m_stats.n_blocks) /
+                 (m_cache_ids.size() * interval()));
+  row.double_add(static_cast<double>(m_stats.n_pickups) / m_cache_ids.size());
+  row.double_add(static_cast<double>(m_stats.n_drops) / m_cache_ids.size());
+  row.double_add(static_cast<double>(m_stats.n_penalty_steps) /
+                 m_penalty_count);
   return true;
-} /* csv_line_build() */
+} /* row_build() */
 
 void cache_metrics_collector::collect(
     const rcppsw::metrics::base_metrics& metrics) {
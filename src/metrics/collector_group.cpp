@@ -0,0 +1,76 @@
+/**
+ * @file collector_group.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/metrics/collector_group.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+typed_metrics_collector* collector_group::operator[](
+    const std::string& name) const {
+  auto it = m_collectors.find(name);
+  return (m_collectors.end() == it) ? nullptr : it->second.get();
+} /* operator[]() */
+
+void collector_group::reset_all(void) {
+  for (auto& pair : m_collectors) {
+    pair.second->reset();
+  } /* for(&pair..) */
+} /* reset_all() */
+
+void collector_group::metrics_write_all(uint clock) {
+  for (auto& pair : m_collectors) {
+    pair.second->metrics_write(clock);
+  } /* for(&pair..) */
+} /* metrics_write_all() */
+
+void collector_group::timestep_reset_all(void) {
+  for (auto& pair : m_collectors) {
+    pair.second->timestep_reset();
+  } /* for(&pair..) */
+} /* timestep_reset_all() */
+
+void collector_group::interval_reset_all(void) {
+  for (auto& pair : m_collectors) {
+    pair.second->interval_reset();
+  } /* for(&pair..) */
+} /* interval_reset_all() */
+
+void collector_group::timestep_inc_all(void) {
+  for (auto& pair : m_collectors) {
+    pair.second->timestep_inc();
+  } /* for(&pair..) */
+} /* timestep_inc_all() */
+
+void collector_group::finalize_all(void) {
+  for (auto& pair : m_collectors) {
+    pair.second->finalize();
+  } /* for(&pair..) */
+} /* finalize_all() */
+
+NS_END(metrics, fordyca);
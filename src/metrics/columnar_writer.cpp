@@ -0,0 +1,94 @@
+/**
+ * @file columnar_writer.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/metrics/columnar_writer.hpp"
+#include <cassert>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Class Constants
+ ******************************************************************************/
+constexpr uint64_t columnar_writer::kMAGIC;
+constexpr uint32_t columnar_writer::kVERSION;
+constexpr size_t columnar_writer::kCHUNK_ROWS;
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+columnar_writer::columnar_writer(const std::string& fname,
+                                 const column_schema& schema)
+    : m_ofile(fname, std::ios::binary | std::ios::trunc),
+      m_schema(schema),
+      m_columns(schema.size()) {
+  for (auto& c : m_columns) {
+    c.reserve(kCHUNK_ROWS);
+  } /* for(&c..) */
+  header_write();
+}
+
+columnar_writer::~columnar_writer(void) { flush(); }
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void columnar_writer::header_write(void) {
+  raw_write(kMAGIC);
+  raw_write(kVERSION);
+  raw_write(static_cast<uint32_t>(m_schema.size()));
+  for (auto& c : m_schema) {
+    raw_write(static_cast<uint8_t>(c.type));
+    raw_write(static_cast<uint32_t>(c.name.size()));
+    m_ofile.write(c.name.data(), static_cast<std::streamsize>(c.name.size()));
+  } /* for(&c..) */
+} /* header_write() */
+
+void columnar_writer::row_write(const metrics_row& row) {
+  assert(row.size() == m_schema.size());
+  for (size_t i = 0; i < row.size(); ++i) {
+    assert(row.type(i) == m_schema[i].type);
+    m_columns[i].push_back(row.raw(i));
+  } /* for(i..) */
+
+  if (!m_columns.empty() && m_columns.front().size() >= kCHUNK_ROWS) {
+    flush();
+  }
+} /* row_write() */
+
+void columnar_writer::flush(void) {
+  if (m_columns.empty() || m_columns.front().empty()) {
+    return;
+  }
+  raw_write(static_cast<uint32_t>(m_columns.front().size()));
+  for (auto& c : m_columns) {
+    m_ofile.write(reinterpret_cast<const char*>(c.data()),
+                  static_cast<std::streamsize>(c.size() * sizeof(uint64_t)));
+    c.clear();
+  } /* for(&c..) */
+  m_ofile.flush();
+} /* flush() */
+
+NS_END(metrics, fordyca);
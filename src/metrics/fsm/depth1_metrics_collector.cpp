@@ -34,27 +34,24 @@ NS_START(fordyca, metrics, fsm);
  ******************************************************************************/
 depth1_metrics_collector::depth1_metrics_collector(const std::string& ofname,
                                                    uint interval)
-    : base_metrics_collector(ofname, interval), m_stats() {}
+    : typed_metrics_collector(ofname, interval), m_stats() {}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-std::string depth1_metrics_collector::csv_header_build(const std::string& header) {
-  // clang-format off
-  return base_metrics_collector::csv_header_build(header) +
-      "n_acquiring_cache" + separator() +
-      "n_cum_acquiring_cache" + separator() +
-      "n_vectoring_to_cache" + separator() +
-      "n_cum_vectoring_to_cache" + separator() +
-      "n_exploring_for_cache" + separator() +
-      "n_cum_exploring_for_cache" + separator() +
-      "n_transporting_to_cache" + separator() +
-      "n_cum_transporting_to_cache" + separator();
-  // clang-format on
-} /* csv_header_build() */
+column_schema depth1_metrics_collector::columns(void) const {
+  return {{"n_acquiring_cache", column_type::kUINT},
+          {"n_cum_acquiring_cache", column_type::kUINT},
+          {"n_vectoring_to_cache", column_type::kUINT},
+          {"n_cum_vectoring_to_cache", column_type::kUINT},
+          {"n_exploring_for_cache", column_type::kUINT},
+          {"n_cum_exploring_for_cache", column_type::kUINT},
+          {"n_transporting_to_cache", column_type::kUINT},
+          {"n_cum_transporting_to_cache", column_type::kUINT}};
+} /* columns() */
 
 void depth1_metrics_collector::reset(void) {
-  base_metrics_collector::reset();
+  typed_metrics_collector::reset();
   reset_after_interval();
 } /* reset() */
 
@@ -76,20 +73,20 @@ void depth1_metrics_collector::collect(
       static_cast<uint>(m.is_transporting_to_cache());
 } /* collect() */
 
-bool depth1_metrics_collector::csv_line_build(std::string& line) {
+bool depth1_metrics_collector::row_build(metrics_row& row) {
   if (!((timestep() + 1) % interval() == 0)) {
     return false;
   }
-  line = std::to_string(m_stats.n_acquiring_cache) + separator() +
-         std::to_string(m_stats.n_cum_acquiring_cache) + separator() +
-         std::to_string(m_stats.n_vectoring_to_cache) + separator() +
-         std::to_string(m_stats.n_cum_vectoring_to_cache) + separator() +
-         std::to_string(m_stats.n_exploring_for_cache) + separator() +
-         std::to_string(m_stats.n_cum_exploring_for_cache) + separator() +
-         std::to_string(m_stats.n_transporting_to_cache) + separator() +
-         std::to_string(m_stats.n_cum_transporting_to_cache) + separator();
+  row.uint_add(m_stats.n_acquiring_cache);
+  row.uint_add(m_stats.n_cum_acquiring_cache);
+  row.uint_add(m_stats.n_vectoring_to_cache);
+  row.uint_add(m_stats.n_cum_vectoring_to_cache);
+  row.uint_add(m_stats.n_exploring_for_cache);
+  row.uint_add(m_stats.n_cum_exploring_for_cache);
+  row.uint_add(m_stats.n_transporting_to_cache);
+  row.uint_add(m_stats.n_cum_transporting_to_cache);
   return true;
-} /* store_foraging_stats() */
+} /* row_build() */
 
 void depth1_metrics_collector::reset_after_interval(void) {
   m_stats.n_cum_exploring_for_cache = 0;
@@ -34,30 +34,27 @@ NS_START(fordyca, metrics, fsm);
  ******************************************************************************/
 distance_metrics_collector::distance_metrics_collector(const std::string& ofname,
                                                        uint interval)
-    : base_metrics_collector(ofname, interval), m_stats() {}
+    : typed_metrics_collector(ofname, interval), m_stats() {}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-std::string distance_metrics_collector::csv_header_build(
-    const std::string& header) {
-  std::string line;
-  line = "cum_distance";
-  return base_metrics_collector::csv_header_build(header) + line;
-} /* csv_header_build() */
+column_schema distance_metrics_collector::columns(void) const {
+  return {{"cum_distance", column_type::kDOUBLE}};
+} /* columns() */
 
 void distance_metrics_collector::reset(void) {
-  base_metrics_collector::reset();
+  typed_metrics_collector::reset();
   reset_after_interval();
 } /* reset() */
 
-bool distance_metrics_collector::csv_line_build(std::string& line) {
+bool distance_metrics_collector::row_build(metrics_row& row) {
   if (!((timestep() + 1) % interval() == 0)) {
     return false;
   }
-  line += std::to_string(m_stats.cum_distance) + separator();
+  row.double_add(m_stats.cum_distance);
   return true;
-} /* csv_line_build() */
+} /* row_build() */
 
 void distance_metrics_collector::collect(
     const rcppsw::metrics::base_metrics& metrics) {
@@ -34,24 +34,20 @@ NS_START(fordyca, metrics, fsm);
  ******************************************************************************/
 stateful_metrics_collector::stateful_metrics_collector(const std::string& ofname,
                                                        uint interval)
-    : base_metrics_collector(ofname, interval), m_stats() {}
+    : typed_metrics_collector(ofname, interval), m_stats() {}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-std::string stateful_metrics_collector::csv_header_build(
-    const std::string& header) {
-  // clang-format off
-  return base_metrics_collector::csv_header_build(header) +
-      "n_acquiring_block"  + separator() +
-      "n_cum_acquiring_block"  + separator() +
-      "n_vectoring_to_block"  + separator() +
-      "n_cum_vectoring_to_block"  + separator();
-  // clang-format on
-} /* csv_header_build() */
+column_schema stateful_metrics_collector::columns(void) const {
+  return {{"n_acquiring_block", column_type::kUINT},
+          {"n_cum_acquiring_block", column_type::kUINT},
+          {"n_vectoring_to_block", column_type::kUINT},
+          {"n_cum_vectoring_to_block", column_type::kUINT}};
+} /* columns() */
 
 void stateful_metrics_collector::reset(void) {
-  base_metrics_collector::reset();
+  typed_metrics_collector::reset();
   reset_after_interval();
 } /* reset() */
 
@@ -66,16 +62,16 @@ void stateful_metrics_collector::collect(
       static_cast<uint>(m.is_vectoring_to_block());
 } /* collect() */
 
-bool stateful_metrics_collector::csv_line_build(std::string& line) {
+bool stateful_metrics_collector::row_build(metrics_row& row) {
   if (!((timestep() + 1) % interval() == 0)) {
     return false;
   }
-  line = std::to_string(m_stats.n_acquiring_block) + separator() +
-         std::to_string(m_stats.n_cum_acquiring_block) + separator() +
-         std::to_string(m_stats.n_vectoring_to_block) + separator() +
-         std::to_string(m_stats.n_cum_vectoring_to_block) + separator();
+  row.uint_add(m_stats.n_acquiring_block);
+  row.uint_add(m_stats.n_cum_acquiring_block);
+  row.uint_add(m_stats.n_vectoring_to_block);
+  row.uint_add(m_stats.n_cum_vectoring_to_block);
   return true;
-} /* csv_line_build() */
+} /* row_build() */
 
 void stateful_metrics_collector::reset_after_interval(void) {
   m_stats.n_cum_acquiring_block = 0;
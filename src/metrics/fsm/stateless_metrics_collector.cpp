@@ -34,26 +34,22 @@ NS_START(fordyca, metrics, fsm);
  ******************************************************************************/
 stateless_metrics_collector::stateless_metrics_collector(const std::string& ofname,
                                                          uint interval)
-    : base_metrics_collector(ofname, interval), m_stats() {}
+    : typed_metrics_collector(ofname, interval), m_stats() {}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-std::string stateless_metrics_collector::csv_header_build(
-    const std::string& header) {
-  // clang-format off
-  return base_metrics_collector::csv_header_build(header) +
-      "n_exploring_for_block"  + separator() +
-      "n_cum_exploring_for_block"  + separator() +
-      "n_avoiding_collision" + separator() +
-      "n_cum_avoiding_collision" + separator() +
-      "n_transporting_to_nest" + separator() +
-      "n_cum_transporting_to_nest" + separator();
-  // clang-format on
-} /* csv_header_build() */
+column_schema stateless_metrics_collector::columns(void) const {
+  return {{"n_exploring_for_block", column_type::kUINT},
+          {"n_cum_exploring_for_block", column_type::kUINT},
+          {"n_avoiding_collision", column_type::kUINT},
+          {"n_cum_avoiding_collision", column_type::kUINT},
+          {"n_transporting_to_nest", column_type::kUINT},
+          {"n_cum_transporting_to_nest", column_type::kUINT}};
+} /* columns() */
 
 void stateless_metrics_collector::reset(void) {
-  base_metrics_collector::reset();
+  typed_metrics_collector::reset();
   reset_after_interval();
 } /* reset() */
 
@@ -73,18 +69,18 @@ void stateless_metrics_collector::collect(
       static_cast<uint>(m.is_avoiding_collision());
 } /* collect() */
 
-bool stateless_metrics_collector::csv_line_build(std::string& line) {
+bool stateless_metrics_collector::row_build(metrics_row& row) {
   if (!((timestep() + 1) % interval() == 0)) {
     return false;
   }
-  line = std::to_string(m_stats.n_exploring_for_block) + separator() +
-         std::to_string(m_stats.n_cum_exploring_for_block) + separator() +
-         std::to_string(m_stats.n_avoiding_collision) + separator() +
-         std::to_string(m_stats.n_cum_avoiding_collision) + separator() +
-         std::to_string(m_stats.n_transporting_to_nest) + separator() +
-         std::to_string(m_stats.n_cum_transporting_to_nest) + separator();
+  row.uint_add(m_stats.n_exploring_for_block);
+  row.uint_add(m_stats.n_cum_exploring_for_block);
+  row.uint_add(m_stats.n_avoiding_collision);
+  row.uint_add(m_stats.n_cum_avoiding_collision);
+  row.uint_add(m_stats.n_transporting_to_nest);
+  row.uint_add(m_stats.n_cum_transporting_to_nest);
   return true;
-} /* store_foraging_stats() */
+} /* row_build() */
 
 void stateless_metrics_collector::reset_after_timestep(void) {
   m_stats.n_avoiding_collision = 0;
@@ -38,29 +38,26 @@ namespace tasks = fordyca::tasks;
  ******************************************************************************/
 execution_metrics_collector::execution_metrics_collector(const std::string& ofname,
                                                          uint interval)
-    : base_metrics_collector(ofname, interval), m_count_stats(), m_int_stats() {}
+    : typed_metrics_collector(ofname, interval),
+      m_count_stats(),
+      m_int_stats() {}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-std::string execution_metrics_collector::csv_header_build(
-    const std::string& header) {
-  // clang-format off
-  std::string line = base_metrics_collector::csv_header_build(header);
-  return line +
-      "collector_avg_interface_delay" + separator() +
-      "harvester_avg_interface_delay" + separator() +
-      "n_collectors"  + separator() +
-      "n_cum_collectors"  + separator() +
-      "n_harvesters" + separator() +
-      "n_cum_harvesters" + separator() +
-      "n_generalists" + separator() +
-      "n_cum_generalists" + separator();
-  // clang-format on
-} /* csv_header_build() */
+column_schema execution_metrics_collector::columns(void) const {
+  return {{"collector_avg_interface_delay", column_type::kDOUBLE},
+          {"harvester_avg_interface_delay", column_type::kDOUBLE},
+          {"n_collectors", column_type::kUINT},
+          {"n_cum_collectors", column_type::kUINT},
+          {"n_harvesters", column_type::kUINT},
+          {"n_cum_harvesters", column_type::kUINT},
+          {"n_generalists", column_type::kUINT},
+          {"n_cum_generalists", column_type::kUINT}};
+} /* columns() */
 
 void execution_metrics_collector::reset(void) {
-  base_metrics_collector::reset();
+  typed_metrics_collector::reset();
   reset_after_interval();
   reset_after_timestep();
 } /* reset() */
@@ -93,26 +90,24 @@ void execution_metrics_collector::collect(
       task.name() == fordyca::tasks::foraging_task::kGeneralistName);
 } /* collect() */
 
-bool execution_metrics_collector::csv_line_build(std::string& line) {
+bool execution_metrics_collector::row_build(metrics_row& row) {
   if (!((timestep() + 1) % interval() == 0)) {
     return false;
   }
-  double avg =
+  row.double_add(
       m_int_stats.cum_collector_delay /
-      (m_count_stats.n_cum_collectors / static_cast<double>(interval()));
-  line = std::to_string(avg) + separator();
-  avg = m_int_stats.cum_harvester_delay /
-        (m_count_stats.n_cum_harvesters / static_cast<double>(interval()));
-
-  line += std::to_string(avg) + separator() +
-          std::to_string(m_count_stats.n_collectors) + separator() +
-          std::to_string(m_count_stats.n_cum_collectors) + separator() +
-          std::to_string(m_count_stats.n_harvesters) + separator() +
-          std::to_string(m_count_stats.n_cum_harvesters) + separator() +
-          std::to_string(m_count_stats.n_generalists) + separator() +
-          std::to_string(m_count_stats.n_cum_generalists) + separator();
+      (m_count_stats.n_cum_collectors / static_cast<double>(interval())));
+  row.double_add(
+      m_int_stats.cum_harvester_delay /
+      (m_count_stats.n_cum_harvesters / static_cast<double>(interval())));
+  row.uint_add(m_count_stats.n_collectors);
+  row.uint_add(m_count_stats.n_cum_collectors);
+  row.uint_add(m_count_stats.n_harvesters);
+  row.uint_add(m_count_stats.n_cum_harvesters);
+  row.uint_add(m_count_stats.n_generalists);
+  row.uint_add(m_count_stats.n_cum_generalists);
   return true;
-} /* store_foraging_stats() */
+} /* row_build() */
 
 void execution_metrics_collector::reset_after_timestep(void) {
   m_count_stats.n_collectors = 0;
@@ -39,7 +39,7 @@ namespace tasks = fordyca::tasks;
 management_metrics_collector::management_metrics_collector(
     const std::string& ofname,
     uint interval)
-    : base_metrics_collector(ofname, interval),
+    : typed_metrics_collector(ofname, interval),
       m_sel_stats(),
       m_partition_stats(),
       m_alloc_stats(),
@@ -48,33 +48,25 @@ management_metrics_collector::management_metrics_collector(
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-std::string management_metrics_collector::csv_header_build(
-    const std::string& header) {
-  // clang-format off
-  std::string line = base_metrics_collector::csv_header_build(header);
-    return line +
-        "harvester_subtask_count" + separator() +
-        "collector_subtask_count" + separator() +
-        "partition_count"  + separator() +
-        "no_partition_count"  + separator() +
-
-        "alloc_sw_count" + separator() +
-        "task_abort_count" + separator() +
-
-        "task_complete_count" + separator() +
-        "collector_complete_count" + separator() +
-        "harvester_complete_count" + separator() +
-        "generalist_complete_count" + separator() +
-
-        "avg_collector_exec_time" + separator() +
-        "avg_harvester_exec_time" + separator() +
-        "avg_generalist_exec_time" + separator() +
-        "avg_task_exec_time" + separator();
-  // clang-format on
-} /* csv_header_build() */
+column_schema management_metrics_collector::columns(void) const {
+  return {{"harvester_subtask_count", column_type::kUINT},
+          {"collector_subtask_count", column_type::kUINT},
+          {"partition_count", column_type::kUINT},
+          {"no_partition_count", column_type::kUINT},
+          {"alloc_sw_count", column_type::kUINT},
+          {"task_abort_count", column_type::kUINT},
+          {"task_complete_count", column_type::kUINT},
+          {"collector_complete_count", column_type::kUINT},
+          {"harvester_complete_count", column_type::kUINT},
+          {"generalist_complete_count", column_type::kUINT},
+          {"avg_collector_exec_time", column_type::kDOUBLE},
+          {"avg_harvester_exec_time", column_type::kDOUBLE},
+          {"avg_generalist_exec_time", column_type::kDOUBLE},
+          {"avg_task_exec_time", column_type::kDOUBLE}};
+} /* columns() */
 
 void management_metrics_collector::reset(void) {
-  base_metrics_collector::reset();
+  typed_metrics_collector::reset();
   reset_after_interval();
 } /* reset() */
 
@@ -115,47 +107,47 @@ void management_metrics_collector::collect(
   }
 } /* collect() */
 
-bool management_metrics_collector::csv_line_build(std::string& line) {
+bool management_metrics_collector::row_build(metrics_row& row) {
   if (!((timestep() + 1) % interval() == 0)) {
     return false;
   }
 
-  line = std::to_string(m_sel_stats.n_harvesters) + separator() +
-         std::to_string(m_sel_stats.n_collectors) + separator() +
-         std::to_string(m_partition_stats.n_partition) + separator() +
-         std::to_string(m_partition_stats.n_no_partition) + separator() +
-         std::to_string(m_alloc_stats.n_alloc_sw) + separator() +
-         std::to_string(m_alloc_stats.n_abort) + separator();
+  row.uint_add(m_sel_stats.n_harvesters);
+  row.uint_add(m_sel_stats.n_collectors);
+  row.uint_add(m_partition_stats.n_partition);
+  row.uint_add(m_partition_stats.n_no_partition);
+  row.uint_add(m_alloc_stats.n_alloc_sw);
+  row.uint_add(m_alloc_stats.n_abort);
 
-  line += std::to_string(m_finish_stats.n_completed) + separator();
-  line += std::to_string(m_finish_stats.n_collector_completed) + separator();
-  line += std::to_string(m_finish_stats.n_harvester_completed) + separator();
-  line += std::to_string(m_finish_stats.n_generalist_completed) + separator();
+  row.uint_add(m_finish_stats.n_completed);
+  row.uint_add(m_finish_stats.n_collector_completed);
+  row.uint_add(m_finish_stats.n_harvester_completed);
+  row.uint_add(m_finish_stats.n_generalist_completed);
 
   double avg = (m_finish_stats.n_collector_completed > 0)
                    ? m_finish_stats.cum_collector_exec_time /
                          m_finish_stats.n_collector_completed
                    : 0;
-  line += std::to_string(avg) + separator();
+  row.double_add(avg);
 
   avg = (m_finish_stats.n_harvester_completed > 0)
             ? m_finish_stats.cum_harvester_exec_time /
                   m_finish_stats.n_harvester_completed
             : 0;
-  line += std::to_string(avg) + separator();
+  row.double_add(avg);
 
   avg = (m_finish_stats.n_generalist_completed > 0)
             ? m_finish_stats.cum_generalist_exec_time /
                   m_finish_stats.n_generalist_completed
             : 0;
-  line += std::to_string(avg) + separator();
+  row.double_add(avg);
 
   avg = (m_finish_stats.n_completed > 0)
             ? m_finish_stats.cum_task_exec_time / m_finish_stats.n_completed
             : 0;
-  line += std::to_string(avg) + separator();
+  row.double_add(avg);
   return true;
-} /* store_foraging_stats() */
+} /* row_build() */
 
 void management_metrics_collector::reset_after_interval(void) {
   m_sel_stats = {0, 0};
@@ -0,0 +1,188 @@
+/**
+ * @file tick_profiler.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/metrics/tick_profiler.hpp"
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Class Constants
+ ******************************************************************************/
+constexpr size_t latency_histogram::kSUB_BUCKET_BITS;
+constexpr size_t latency_histogram::kSUB_BUCKETS;
+constexpr size_t latency_histogram::kN_BUCKETS;
+
+/*******************************************************************************
+ * latency_histogram Member Functions
+ ******************************************************************************/
+size_t latency_histogram::bucket_index(uint64_t ns) {
+  if (ns < 2 * kSUB_BUCKETS) {
+    return static_cast<size_t>(ns);
+  }
+  /*
+   * Shift the value so that it has kSUB_BUCKET_BITS + 1 significant bits; the
+   * top one is always set, and the rest select the sub-bucket.
+   */
+  size_t msb = 63 - static_cast<size_t>(__builtin_clzll(ns));
+  size_t shift = msb - kSUB_BUCKET_BITS;
+  return kSUB_BUCKETS * shift + static_cast<size_t>(ns >> shift);
+} /* bucket_index() */
+
+uint64_t latency_histogram::bucket_lower(size_t index) {
+  if (index < 2 * kSUB_BUCKETS) {
+    return index;
+  }
+  size_t shift = index / kSUB_BUCKETS - 1;
+  return static_cast<uint64_t>(index - kSUB_BUCKETS * shift) << shift;
+} /* bucket_lower() */
+
+uint64_t latency_histogram::bucket_upper(size_t index) {
+  if (index < 2 * kSUB_BUCKETS) {
+    return index;
+  }
+  size_t shift = index / kSUB_BUCKETS - 1;
+  return bucket_lower(index) + ((static_cast<uint64_t>(1) << shift) - 1);
+} /* bucket_upper() */
+
+void latency_histogram::record(uint64_t ns) {
+  m_buckets[bucket_index(ns)].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_sum.fetch_add(ns, std::memory_order_relaxed);
+
+  uint64_t old = m_min.load(std::memory_order_relaxed);
+  while (ns < old && !m_min.compare_exchange_weak(old, ns)) {
+  }
+  old = m_max.load(std::memory_order_relaxed);
+  while (ns > old && !m_max.compare_exchange_weak(old, ns)) {
+  }
+} /* record() */
+
+void latency_histogram::reset(void) {
+  for (auto& b : m_buckets) {
+    b.store(0);
+  } /* for(&b..) */
+  m_count.store(0);
+  m_sum.store(0);
+  m_min.store(std::numeric_limits<uint64_t>::max());
+  m_max.store(0);
+} /* reset() */
+
+uint64_t latency_histogram::min(void) const {
+  return (0 == count()) ? 0 : m_min.load();
+} /* min() */
+
+double latency_histogram::mean(void) const {
+  uint64_t n = count();
+  return (0 == n) ? 0.0 : static_cast<double>(m_sum.load()) / n;
+} /* mean() */
+
+uint64_t latency_histogram::percentile(double p) const {
+  uint64_t n = count();
+  if (0 == n) {
+    return 0;
+  }
+  /* the rank of the value we want, rounding up, in [1, n] */
+  auto rank = static_cast<uint64_t>(p / 100.0 * n + 0.5);
+  rank = std::max(static_cast<uint64_t>(1), std::min(rank, n));
+
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kN_BUCKETS; ++i) {
+    seen += bucket_count(i);
+    if (seen >= rank) {
+      return std::min(bucket_upper(i), max());
+    }
+  } /* for(i..) */
+  return max();
+} /* percentile() */
+
+/*******************************************************************************
+ * tick_profiler Member Functions
+ ******************************************************************************/
+tick_profiler& tick_profiler::instance(void) {
+  static tick_profiler profiler;
+  return profiler;
+} /* instance() */
+
+void tick_profiler::reset(void) {
+  for (auto& h : m_phases) {
+    h.reset();
+  } /* for(&h..) */
+} /* reset() */
+
+const char* tick_profiler::phase_name(tick_phase phase) {
+  switch (phase) {
+    case tick_phase::kPROCESS_LOS:
+      return "process_los";
+    case tick_phase::kGRID_UPDATE:
+      return "occupancy_grid_update";
+    case tick_phase::kEXECUTIVE_RUN:
+      return "executive_run";
+    case tick_phase::kARENA_INTERACT:
+      return "arena_interact";
+    case tick_phase::kFLOOR_COLOR:
+      return "floor_color";
+    case tick_phase::kMETRICS_WRITE:
+      return "metrics_write";
+    default:
+      return "unknown";
+  } /* switch() */
+} /* phase_name() */
+
+void tick_profiler::write(const std::string& fname,
+                          const std::string& hist_fname) const {
+  std::ofstream ofile(fname);
+  ofile << "phase;count;min_ns;mean_ns;p50_ns;p90_ns;p99_ns;p99.9_ns;max_ns;"
+        << "\n";
+  for (size_t i = 0; i < m_phases.size(); ++i) {
+    const latency_histogram& h = m_phases[i];
+    ofile << phase_name(static_cast<tick_phase>(i)) << ";" << h.count() << ";"
+          << h.min() << ";" << h.mean() << ";" << h.percentile(50.0) << ";"
+          << h.percentile(90.0) << ";" << h.percentile(99.0) << ";"
+          << h.percentile(99.9) << ";" << h.max() << ";\n";
+  } /* for(i..) */
+
+  if (hist_fname.empty()) {
+    return;
+  }
+  std::ofstream hfile(hist_fname);
+  hfile << "phase;lower_ns;upper_ns;count;\n";
+  for (size_t i = 0; i < m_phases.size(); ++i) {
+    const latency_histogram& h = m_phases[i];
+    for (size_t j = 0; j < latency_histogram::kN_BUCKETS; ++j) {
+      if (0 != h.bucket_count(j)) {
+        hfile << phase_name(static_cast<tick_phase>(i)) << ";"
+              << latency_histogram::bucket_lower(j) << ";"
+              << latency_histogram::bucket_upper(j) << ";" << h.bucket_count(j)
+              << ";\n";
+      }
+    } /* for(j..) */
+  }   /* for(i..) */
+} /* write() */
+
+NS_END(metrics, fordyca);
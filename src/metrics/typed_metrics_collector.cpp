@@ -0,0 +1,100 @@
+/**
+ * @file typed_metrics_collector.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/metrics/typed_metrics_collector.hpp"
+#include <cstring>
+
+#include "fordyca/metrics/async_metrics_writer.hpp"
+#include "fordyca/metrics/columnar_writer.hpp"
+#include "fordyca/metrics/csv_writer.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics);
+
+/*******************************************************************************
+ * Class Constants
+ ******************************************************************************/
+constexpr char typed_metrics_collector::kBINARY_EXT[];
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+typed_metrics_collector::typed_metrics_collector(const std::string& ofname,
+                                                 uint interval)
+    : m_interval(interval),
+      m_binary(is_binary(ofname)),
+      m_ofname(ofname) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+bool typed_metrics_collector::is_binary(const std::string& ofname) {
+  size_t len = std::strlen(kBINARY_EXT);
+  return ofname.size() > len &&
+         0 == ofname.compare(ofname.size() - len, len, kBINARY_EXT);
+} /* is_binary() */
+
+void typed_metrics_collector::reset(void) {
+  column_schema schema = columns();
+  schema.insert(schema.begin(), {"clock", column_type::kUINT});
+
+  /* finish with the old file before truncating it */
+  finalize();
+  m_timestep = 0;
+  if (m_binary) {
+    m_writer = rcppsw::make_unique<columnar_writer>(m_ofname, schema);
+  } else {
+    m_writer =
+        rcppsw::make_unique<csv_writer>(m_ofname, schema, separator());
+  }
+} /* reset() */
+
+void typed_metrics_collector::metrics_write(uint clock) {
+  m_row.clear();
+  m_row.uint_add(clock);
+  if (!row_build(m_row)) {
+    return;
+  }
+  if (nullptr != m_async) {
+    m_async->enqueue(m_writer.get(), m_row);
+  } else {
+    m_writer->row_write(m_row);
+  }
+} /* metrics_write() */
+
+void typed_metrics_collector::interval_reset(void) {
+  if ((m_timestep + 1) % m_interval == 0) {
+    reset_after_interval();
+  }
+} /* interval_reset() */
+
+void typed_metrics_collector::finalize(void) {
+  if (nullptr != m_async) {
+    m_async->drain();
+  }
+  m_writer.reset();
+} /* finalize() */
+
+NS_END(metrics, fordyca);
@@ -40,6 +40,10 @@ void occupancy_grid_parser::parse(argos::TConfigurationNode& node) {
   m_pheromone_parser.parse(argos::GetNode(pnode, "pheromone"));
   m_params->grid = *m_grid_parser.get_results();
   m_params->pheromone = *m_pheromone_parser.get_results();
+  argos::GetNodeAttributeOrDefault(pnode,
+                                   "shared_baseline",
+                                   m_params->shared_baseline,
+                                   m_params->shared_baseline);
 } /* parse() */
 
 void occupancy_grid_parser::show(std::ostream& stream) {
@@ -47,6 +51,7 @@ void occupancy_grid_parser::show(std::ostream& stream) {
             "params\n====================\n";
   m_grid_parser.show(stream);
   m_pheromone_parser.show(stream);
+  stream << "shared_baseline=" << m_params->shared_baseline << std::endl;
 } /* show() */
 
 __pure bool occupancy_grid_parser::validate(void) {
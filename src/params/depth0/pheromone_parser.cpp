@@ -35,12 +35,17 @@ void pheromone_parser::parse(argos::TConfigurationNode& node) {
   m_params = rcppsw::make_unique<struct pheromone_params>();
   m_params->rho = std::atof(node.GetAttribute("rho").c_str());
   argos::GetNodeAttribute(node, "repeat_deposit", m_params->repeat_deposit);
+  argos::GetNodeAttributeOrDefault(node,
+                                   "lazy_decay",
+                                   m_params->lazy_decay,
+                                   m_params->lazy_decay);
 } /* parse() */
 
 void pheromone_parser::show(std::ostream& stream) {
   stream << "====================\nPheromone params\n====================\n";
   stream << "rho=" << m_params->rho << std::endl;
   stream << "repeat_deposit=" << m_params->repeat_deposit << std::endl;
+  stream << "lazy_decay=" << m_params->lazy_decay << std::endl;
 } /* show() */
 
 __pure bool pheromone_parser::validate(void) {
@@ -0,0 +1,62 @@
+/**
+ * @file profiling_parser.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/params/profiling_parser.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, params);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void profiling_parser::parse(argos::TConfigurationNode& node) {
+  m_params = rcppsw::make_unique<struct profiling_params>();
+
+  if (nullptr != node.FirstChild("profiling", false)) {
+    argos::TConfigurationNode pnode = argos::GetNode(node, "profiling");
+    argos::GetNodeAttribute(pnode, "enabled", m_params->enabled);
+    argos::GetNodeAttributeOrDefault(pnode,
+                                     "summary_fname",
+                                     m_params->summary_fname,
+                                     m_params->summary_fname);
+    argos::GetNodeAttributeOrDefault(pnode,
+                                     "histogram_fname",
+                                     m_params->histogram_fname,
+                                     m_params->histogram_fname);
+  }
+} /* parse() */
+
+void profiling_parser::show(std::ostream& stream) {
+  stream << "====================\nProfiling params\n====================\n";
+  stream << "enabled=" << m_params->enabled << std::endl;
+  stream << "summary_fname=" << m_params->summary_fname << std::endl;
+  stream << "histogram_fname=" << m_params->histogram_fname << std::endl;
+} /* show() */
+
+__pure bool profiling_parser::validate(void) {
+  return !m_params->enabled || !m_params->summary_fname.empty();
+} /* validate() */
+
+NS_END(params, fordyca);
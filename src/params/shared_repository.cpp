@@ -0,0 +1,57 @@
+/**
+ * @file shared_repository.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/params/shared_repository.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, params);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+std::mutex& shared_repository::mutex(void) {
+  static std::mutex mtx;
+  return mtx;
+} /* mutex() */
+
+std::map<shared_repository::key_type, shared_repository::entry>&
+shared_repository::repos(void) {
+  static std::map<key_type, entry> repos;
+  return repos;
+} /* repos() */
+
+void shared_repository::release(argos::TConfigurationNode& node) {
+  std::lock_guard<std::mutex> lock(mutex());
+  const void* document = node.GetTiXmlPointer()->GetDocument();
+  for (auto it = repos().begin(); it != repos().end();) {
+    if (std::get<0>(it->first) == document) {
+      it = repos().erase(it);
+    } else {
+      ++it;
+    }
+  } /* for(it..) */
+} /* release() */
+
+NS_END(params, fordyca);
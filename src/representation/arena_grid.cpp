@@ -0,0 +1,91 @@
+/**
+ * @file arena_grid.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/representation/arena_grid.hpp"
+#include <algorithm>
+#include <cassert>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, representation);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+arena_grid::arena_grid(double resolution, size_t x_max, size_t y_max)
+    : m_resolution(resolution),
+      m_xrsize(x_max),
+      m_yrsize(y_max),
+      m_cells(static_cast<size_t>(x_max / resolution),
+              static_cast<size_t>(y_max / resolution),
+              [](size_t i, size_t j, cell2D& cell) {
+                cell.loc(rcppsw::math::dcoord2(i, j));
+                cell.fsm().event_empty();
+              }) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void arena_grid::subcircle_allocate(size_t x, size_t y, size_t radius) {
+  auto bounds = subcircle_bounds(x, y, radius);
+  m_cells.allocate(bounds.first.first,
+                   bounds.first.second,
+                   bounds.second.first,
+                   bounds.second.second);
+} /* subcircle_allocate() */
+
+arena_grid_view arena_grid::subcircle(size_t x,
+                                      size_t y,
+                                      size_t radius) const {
+  arena_grid_view view;
+  subcircle(x, y, radius, &view);
+  return view;
+} /* subcircle() */
+
+void arena_grid::subcircle(size_t x,
+                           size_t y,
+                           size_t radius,
+                           arena_grid_view* const view) const {
+  auto bounds = subcircle_bounds(x, y, radius);
+  size_t xlow = bounds.first.first;
+  size_t ylow = bounds.first.second;
+  view->reshape(bounds.second.first - xlow, bounds.second.second - ylow);
+  for (size_t i = xlow; i < bounds.second.first; ++i) {
+    for (size_t j = ylow; j < bounds.second.second; ++j) {
+      assert(m_cells.allocated(i, j));
+      (*view)(i - xlow, j - ylow) = &m_cells.access(i, j);
+    } /* for(j..) */
+  }   /* for(i..) */
+} /* subcircle() */
+
+std::pair<rcppsw::math::dcoord2, rcppsw::math::dcoord2> arena_grid::
+    subcircle_bounds(size_t x, size_t y, size_t radius) const {
+  return std::make_pair(
+      rcppsw::math::dcoord2((x > radius) ? x - radius : 0,
+                            (y > radius) ? y - radius : 0),
+      rcppsw::math::dcoord2(std::min(x + radius + 1, xdsize()),
+                            std::min(y + radius + 1, ydsize())));
+} /* subcircle_bounds() */
+
+NS_END(representation, fordyca);
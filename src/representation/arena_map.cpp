@@ -21,7 +21,10 @@
  * Includes
  ******************************************************************************/
 #include "fordyca/representation/arena_map.hpp"
-#include "fordyca/events/cell_empty.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "fordyca/events/free_block_drop.hpp"
 #include "fordyca/params/arena_map_params.hpp"
 #include "fordyca/representation/arena_cache.hpp"
@@ -39,10 +42,19 @@ NS_START(fordyca, representation);
  ******************************************************************************/
 arena_map::arena_map(const struct params::arena_map_params* params)
     : m_cache_removed(false),
+      m_block_search_radius(static_cast<size_t>(
+          std::ceil(params->block.dimension / 2.0 / params->grid.resolution))),
+      m_cache_search_radius(static_cast<size_t>(std::ceil(
+                                params->cache.dimension / 2.0 /
+                                params->grid.resolution)) +
+                            1),
       mc_cache_params(params->cache),
       mc_nest_center(params->nest_center),
+      mc_nest_xrange(params->nest_x),
+      mc_nest_yrange(params->nest_y),
       m_blocks(params->block.n_blocks),
       m_caches(),
+      m_cache_index(),
       m_block_distributor(argos::CRange<double>(params->grid.lower.GetX(),
                                                 params->grid.upper.GetX()),
                           argos::CRange<double>(params->grid.lower.GetY(),
@@ -53,8 +65,8 @@ arena_map::arena_map(const struct params::arena_map_params* params)
       m_server(rcppsw::er::g_server),
       m_grid(params->grid.resolution,
              static_cast<size_t>(params->grid.upper.GetX()),
-             static_cast<size_t>(params->grid.upper.GetY()),
-             m_server) {
+             static_cast<size_t>(params->grid.upper.GetY())),
+      m_floor(m_grid.xdsize(), m_grid.ydsize()) {
   deferred_client_init(m_server);
   insmod("arena_map", rcppsw::er::er_lvl::DIAG, rcppsw::er::er_lvl::NOM);
 
@@ -64,12 +76,8 @@ arena_map::arena_map(const struct params::arena_map_params* params)
          m_grid.xrsize(),
          m_grid.yrsize(),
          m_grid.resolution());
-  for (size_t i = 0; i < m_grid.xdsize(); ++i) {
-    for (size_t j = 0; j < m_grid.ydsize(); ++j) {
-      cell2D& cell = m_grid.access(i, j);
-      cell.loc(rcppsw::math::dcoord2(i, j));
-    } /* for(j..) */
-  }   /* for(i..) */
+  m_block_distributor.grid_init(
+      m_grid.xdsize(), m_grid.ydsize(), m_grid.resolution());
 
   for (size_t i = 0; i < m_blocks.size(); ++i) {
     m_blocks[i] =
@@ -81,53 +89,106 @@ arena_map::arena_map(const struct params::arena_map_params* params)
  * Member Functions
  ******************************************************************************/
 __pure int arena_map::robot_on_block(const argos::CVector2& pos) const {
-  for (size_t i = 0; i < m_blocks.size(); ++i) {
-    if (m_blocks[i]->contains_point(pos)) {
-      return static_cast<int>(i);
-    }
-  } /* for(i..) */
-  return -1;
+  /*
+   * Blocks always sit on the cell they are discretized to, either as the block
+   * for the cell, or as one of the blocks in the cache hosted by the cell, so
+   * only cells within reach of the block extent need to be checked. The lowest
+   * ID is returned if the robot is somehow on more than one block, same as a
+   * linear scan over all blocks would.
+   */
+  auto range = search_range(pos, m_block_search_radius);
+  int id = -1;
+  for (size_t i = range.first.first; i <= range.second.first; ++i) {
+    for (size_t j = range.first.second; j <= range.second.second; ++j) {
+      const cell2D& cell = m_grid.access(i, j);
+      if (cell.state_has_block()) {
+        if (cell.block()->contains_point(pos) &&
+            (-1 == id || cell.block()->id() < id)) {
+          id = cell.block()->id();
+        }
+      } else if (cell.state_has_cache()) {
+        for (auto& b : cell.cache()->blocks()) {
+          if (b->contains_point(pos) && (-1 == id || b->id() < id)) {
+            id = b->id();
+          }
+        } /* for(&b..) */
+      }
+    } /* for(j..) */
+  }   /* for(i..) */
+  return id;
 } /* robot_on_block() */
 
 __pure int arena_map::robot_on_cache(const argos::CVector2& pos) const {
-  for (size_t i = 0; i < m_caches.size(); ++i) {
-    if (m_caches[i]->contains_point(pos)) {
-      return static_cast<int>(i);
-    }
-  } /* for(i..) */
-  return -1;
+  auto range = search_range(pos, m_cache_search_radius);
+  int index = -1;
+  for (size_t i = range.first.first; i <= range.second.first; ++i) {
+    for (size_t j = range.first.second; j <= range.second.second; ++j) {
+      const cell2D& cell = m_grid.access(i, j);
+      if (!cell.state_has_cache() || !cell.cache()->contains_point(pos)) {
+        continue;
+      }
+      auto it = m_cache_index.find(cell.cache().get());
+      if (it == m_cache_index.end()) {
+        continue;
+      }
+      int candidate = static_cast<int>(it->second);
+      if (-1 == index || candidate < index) {
+        index = candidate;
+      }
+    } /* for(j..) */
+  }   /* for(i..) */
+  return index;
 } /* robot_on_cache() */
 
+std::pair<rcppsw::math::dcoord2, rcppsw::math::dcoord2> arena_map::
+    search_range(const argos::CVector2& pos, size_t radius) const {
+  long x = std::lround(pos.GetX() / m_grid.resolution());
+  long y = std::lround(pos.GetY() / m_grid.resolution());
+  long r = static_cast<long>(radius);
+  long xmax = static_cast<long>(m_grid.xdsize()) - 1;
+  long ymax = static_cast<long>(m_grid.ydsize()) - 1;
+
+  rcppsw::math::dcoord2 ll(
+      static_cast<size_t>(std::min(std::max(x - r, 0L), xmax)),
+      static_cast<size_t>(std::min(std::max(y - r, 0L), ymax)));
+  rcppsw::math::dcoord2 ur(
+      static_cast<size_t>(std::min(std::max(x + r, 0L), xmax)),
+      static_cast<size_t>(std::min(std::max(y + r, 0L), ymax)));
+  return std::make_pair(ll, ur);
+} /* search_range() */
+
 void arena_map::distribute_block(const std::shared_ptr<block>& block) {
-  cell2D* cell = nullptr;
-  while (true) {
-    argos::CVector2 r_coord;
-    if (m_block_distributor.distribute_block(*block, &r_coord)) {
-      rcppsw::math::dcoord2 d_coord =
-          math::rcoord_to_dcoord(r_coord, m_grid.resolution());
-      cell = &m_grid.access(d_coord.first, d_coord.second);
-
-      /*
-       * You can only distribute blocks to cells that do not currently have
-       * anything in them.
-       */
-      if (!cell->state_has_block() && !cell->state_has_cache()) {
-        events::free_block_drop op(
-            m_server, block, d_coord.first, d_coord.second, m_grid.resolution());
-        cell->accept(op);
-        break;
-      }
-    } else { /* no distributing needs to be done (respawn is disabled) */
-      return;
-    }
-  } /* while() */
+  rcppsw::math::dcoord2 d_coord;
+  if (!m_block_distributor.distribute_block(*block, &d_coord)) {
+    ER_ASSERT(!m_block_distributor.free_cells_exhausted(),
+              "FATAL: No free cells left to distribute block%d to",
+              block->id());
+    /* no distributing needs to be done (respawn is disabled) */
+    return;
+  }
+
+  /*
+   * You can only distribute blocks to cells that do not currently have
+   * anything in them, which the distributor guarantees.
+   */
+  cell2D& cell = m_grid.access(d_coord.first, d_coord.second);
+  ER_ASSERT(!cell.state_has_block() && !cell.state_has_cache(),
+            "FATAL: Distributing block%d to occupied cell (%zu, %zu)",
+            block->id(),
+            d_coord.first,
+            d_coord.second);
+  events::free_block_drop op(
+      m_server, block, d_coord.first, d_coord.second, m_grid.resolution());
+  cell.accept(op);
+  cell_changed(d_coord);
+
   ER_NOM("Block%d: real_loc=(%f, %f) discrete_loc=(%zu, %zu) ptr=%p",
          block->id(),
          block->real_loc().GetX(),
          block->real_loc().GetY(),
          block->discrete_loc().first,
          block->discrete_loc().second,
-         reinterpret_cast<void*>(cell->block().get()));
+         reinterpret_cast<void*>(cell.block().get()));
 } /* distribute_block() */
 
 void arena_map::static_cache_create(void) {
@@ -165,33 +226,155 @@ void arena_map::static_cache_create(void) {
     }
   } /* for(b..) */
 
+  /*
+   * The blocks used to create the cache can come from anywhere in the arena,
+   * so just unpaint the whole floor.
+   */
   m_caches = c.create_all(blocks);
   c.update_host_cells(m_grid, m_caches);
+  cache_index_rebuild();
+  m_floor.invalidate_all();
+  free_cells_rebuild();
 } /* static_cache_create() */
 
 void arena_map::distribute_blocks(void) {
+  free_cells_rebuild();
   for (auto& b : m_blocks) {
     distribute_block(b);
   } /* for(b..) */
+  ER_NOM("%zu/%zu grid tiles allocated",
+         m_grid.n_allocated_tiles(),
+         m_grid.n_tiles());
+} /* distribute_blocks() */
 
+void arena_map::cache_remove(const std::shared_ptr<arena_cache>& victim) {
+  cell_changed(victim->discrete_loc());
+  m_caches.erase(std::remove(m_caches.begin(), m_caches.end(), victim));
+  cache_index_rebuild();
+} /* cache_remove() */
+
+void arena_map::cache_index_rebuild(void) {
+  m_cache_index.clear();
+  for (size_t i = 0; i < m_caches.size(); ++i) {
+    m_cache_index[m_caches[i].get()] = i;
+  } /* for(i..) */
+} /* cache_index_rebuild() */
+
+argos::CColor arena_map::floor_color(const argos::CVector2& pos) {
+  /*
+   * Cells are the points that discretize to them, so that every point in a
+   * cell has the same search range for blocks/caches.
+   */
+  auto d = search_range(pos, 0).first;
+  const argos::CColor* color = m_floor.color(d.first, d.second);
+  if (nullptr != color) {
+    return *color;
+  } else if (!m_floor.mixed(d.first, d.second)) {
+    argos::CColor uniform;
+    if (floor_cell_uniform(d, &uniform)) {
+      m_floor.paint(d.first, d.second, uniform);
+      return uniform;
+    }
+    m_floor.paint_mixed(d.first, d.second);
+  }
+  return floor_color_calc(pos);
+} /* floor_color() */
+
+void arena_map::cell_changed(const rcppsw::math::dcoord2& d) {
+  const cell2D& cell = m_grid.access(d.first, d.second);
+  m_block_distributor.cell_update(
+      d, !cell.state_has_block() && !cell.state_has_cache());
+  floor_invalidate(d);
+} /* cell_changed() */
+
+void arena_map::free_cells_rebuild(void) {
+  /*
+   * Cells only ever contain blocks/caches in allocated tiles, and all cells
+   * start out free, so the cells of unallocated tiles are already free.
+   */
+  m_grid.for_each_allocated([&](size_t i, size_t j, const cell2D& cell) {
+    m_block_distributor.cell_update(
+        rcppsw::math::dcoord2(i, j),
+        !cell.state_has_block() && !cell.state_has_cache());
+  });
+} /* free_cells_rebuild() */
+
+void arena_map::floor_invalidate(const rcppsw::math::dcoord2& d) {
   /*
-   * Once all blocks have been distributed, and (possibly) all caches have been
-   * created via block consolidation, then all cells that do not have blocks or
-   * caches are empty.
+   * The cell can only affect the colors of the cells that would search it for
+   * blocks/caches.
    */
-  for (size_t i = 0; i < m_grid.xdsize(); ++i) {
-    for (size_t j = 0; j < m_grid.ydsize(); ++j) {
-      cell2D& cell = m_grid.access(i, j);
-      if (!cell.state_has_block() && !cell.state_has_cache()) {
-        events::cell_empty op(i, j);
-        cell.accept(op);
+  size_t r = std::max(m_block_search_radius, m_cache_search_radius);
+  m_floor.invalidate(d.first - std::min(d.first, r),
+                     d.second - std::min(d.second, r),
+                     d.first + r,
+                     d.second + r);
+} /* floor_invalidate() */
+
+bool arena_map::floor_cell_uniform(const rcppsw::math::dcoord2& d,
+                                   argos::CColor* color) const {
+  /*
+   * The points that discretize to the cell, extended to infinity for cells on
+   * the edge of the arena, to which points outside of it are clamped.
+   */
+  double res = m_grid.resolution();
+  double inf = std::numeric_limits<double>::infinity();
+  double xmin = (0 == d.first) ? -inf : (d.first - 0.5) * res;
+  double ymin = (0 == d.second) ? -inf : (d.second - 0.5) * res;
+  double xmax = (m_grid.xdsize() - 1 == d.first) ? inf : (d.first + 0.5) * res;
+  double ymax =
+      (m_grid.ydsize() - 1 == d.second) ? inf : (d.second + 0.5) * res;
+
+  /* The nest is a light gray, and is drawn over everything else */
+  if (mc_nest_xrange.GetMin() <= xmin && xmax <= mc_nest_xrange.GetMax() &&
+      mc_nest_yrange.GetMin() <= ymin && ymax <= mc_nest_yrange.GetMax()) {
+    *color = argos::CColor::GRAY70;
+    return true;
+  }
+  if (!(xmax <= mc_nest_xrange.GetMin() || xmin > mc_nest_xrange.GetMax() ||
+        ymax <= mc_nest_yrange.GetMin() || ymin > mc_nest_yrange.GetMax())) {
+    return false;
+  }
+
+  /*
+   * Otherwise, the cell is white if none of the cells searched for the points
+   * in it have a block or a cache.
+   */
+  auto range = search_range(
+      math::dcoord_to_rcoord(d, res),
+      std::max(m_block_search_radius, m_cache_search_radius));
+  for (size_t i = range.first.first; i <= range.second.first; ++i) {
+    for (size_t j = range.first.second; j <= range.second.second; ++j) {
+      const cell2D& cell = m_grid.access(i, j);
+      if (cell.state_has_block() || cell.state_has_cache()) {
+        return false;
       }
     } /* for(j..) */
   }   /* for(i..) */
-} /* distribute_blocks() */
+  *color = argos::CColor::WHITE;
+  return true;
+} /* floor_cell_uniform() */
 
-void arena_map::cache_remove(const std::shared_ptr<arena_cache>& victim) {
-  m_caches.erase(std::remove(m_caches.begin(), m_caches.end(), victim));
-} /* cache_remove() */
+argos::CColor arena_map::floor_color_calc(const argos::CVector2& pos) const {
+  /* The nest is a light gray */
+  if (mc_nest_xrange.WithinMinBoundIncludedMaxBoundIncluded(pos.GetX()) &&
+      mc_nest_yrange.WithinMinBoundIncludedMaxBoundIncluded(pos.GetY())) {
+    return argos::CColor::GRAY70;
+  }
+
+  /*
+   * Blocks are inside caches, so display the cache the point is inside FIRST,
+   * so that you don't have blocks rendering inside of caches.
+   */
+  int cache = robot_on_cache(pos);
+  if (-1 != cache) {
+    return m_caches[cache]->color();
+  }
+  int block = robot_on_block(pos);
+  if (-1 != block) {
+    return m_blocks[block]->color();
+  }
+  return argos::CColor::WHITE;
+} /* floor_color_calc() */
 
 NS_END(representation, fordyca);
@@ -57,6 +57,7 @@ base_cache::base_cache(double dimension,
  ******************************************************************************/
 void base_cache::block_remove(const std::shared_ptr<block>& block) {
   m_blocks.erase(std::find(m_blocks.begin(), m_blocks.end(), block));
+  version_bump();
 } /* block_remove() */
 
 std::unique_ptr<base_cache> base_cache::clone(void) const {
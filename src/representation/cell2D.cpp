@@ -24,41 +24,38 @@
 #include "fordyca/representation/cell2D.hpp"
 #include "fordyca/representation/base_cache.hpp"
 #include "fordyca/representation/block.hpp"
-#include "rcppsw/er/server.hpp"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, representation);
 
-/*******************************************************************************
- * Constructors/Destructor
- ******************************************************************************/
-cell2D::cell2D(const std::shared_ptr<rcppsw::er::server>& server)
-    : m_loc(), m_fsm(server) {
-  m_fsm.init();
-}
-
-cell2D::cell2D(void) : m_loc(), m_fsm() { m_fsm.init(); }
-
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
 __pure const std::shared_ptr<representation::block> cell2D::block(void) const {
-  return std::dynamic_pointer_cast<representation::block>(m_entity);
+  if (nullptr == m_entity) {
+    return nullptr;
+  }
+  return std::dynamic_pointer_cast<representation::block>(
+      m_entity->shared_from_this());
 } /* block() */
 
 __pure std::shared_ptr<representation::block> cell2D::block(void) {
-  return std::dynamic_pointer_cast<representation::block>(m_entity);
+  return static_cast<const cell2D*>(this)->block();
 } /* block() */
 
 __pure std::shared_ptr<representation::base_cache> cell2D::cache(void) {
-  return std::dynamic_pointer_cast<representation::base_cache>(m_entity);
+  return static_cast<const cell2D*>(this)->cache();
 } /* cache() */
 
 __pure const std::shared_ptr<representation::base_cache> cell2D::cache(
     void) const {
-  return std::dynamic_pointer_cast<representation::base_cache>(m_entity);
+  if (nullptr == m_entity) {
+    return nullptr;
+  }
+  return std::dynamic_pointer_cast<representation::base_cache>(
+      m_entity->shared_from_this());
 } /* cache() */
 
 NS_END(representation, fordyca);
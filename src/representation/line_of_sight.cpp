@@ -22,6 +22,8 @@
  * Includes
  *****************************************************************************/
 #include "fordyca/representation/line_of_sight.hpp"
+#include <algorithm>
+
 #include "fordyca/representation/base_cache.hpp"
 #include "fordyca/representation/block.hpp"
 #include "fordyca/representation/cell2D.hpp"
@@ -34,49 +36,140 @@ NS_START(fordyca, representation);
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-line_of_sight::const_block_list line_of_sight::blocks(void) const {
-  const_block_list blocks;
-  for (size_t i = 0; i < m_view.shape()[0]; ++i) {
-    for (size_t j = 0; j < m_view.shape()[1]; ++j) {
-      cell2D* cell = m_view[i][j];
+void line_of_sight::retarget(const arena_grid_view& c_view,
+                             const rcppsw::math::dcoord2& center) {
+  m_view = c_view;
+  retarget_reset(center);
+} /* retarget() */
+
+void line_of_sight::retarget(const arena_grid& grid,
+                             const rcppsw::math::dcoord2& center,
+                             size_t radius) {
+  if (!m_view) {
+    m_view.emplace();
+  }
+  grid.subcircle(center.first, center.second, radius, m_view.get_ptr());
+  retarget_reset(center);
+} /* retarget() */
+
+void line_of_sight::retarget_reset(const rcppsw::math::dcoord2& center) {
+  m_center = center;
+  m_extra_caches.clear();
+  m_delta_valid = false;
+} /* retarget_reset() */
+
+const line_of_sight::const_block_vector& line_of_sight::blocks(void) const {
+  m_blocks.clear();
+  for (size_t i = 0; i < xsize(); ++i) {
+    for (size_t j = 0; j < ysize(); ++j) {
+      const cell2D* cell = (*m_view)(i, j);
       assert(cell);
       if (cell->state_has_block()) {
-        assert(std::dynamic_pointer_cast<block>(cell->entity()));
-        blocks.push_back(cell->block());
+        assert(dynamic_cast<block*>(cell->entity()));
+        m_blocks.push_back(cell->block());
       }
     } /* for(j..) */
   }   /* for(i..) */
-  return blocks;
+  return m_blocks;
 } /* blocks() */
 
-line_of_sight::const_cache_list line_of_sight::caches(void) const {
-  const_cache_list caches = m_caches;
+const line_of_sight::const_cache_vector& line_of_sight::caches(void) const {
+  m_caches.assign(m_extra_caches.begin(), m_extra_caches.end());
 
-  for (size_t i = 0; i < m_view.shape()[0]; ++i) {
-    for (size_t j = 0; j < m_view.shape()[1]; ++j) {
-      cell2D* cell = m_view[i][j];
+  for (size_t i = 0; i < xsize(); ++i) {
+    for (size_t j = 0; j < ysize(); ++j) {
+      const cell2D* cell = (*m_view)(i, j);
       assert(cell);
       if (cell->state_has_cache()) {
-        assert(std::dynamic_pointer_cast<base_cache>(cell->entity()));
-        caches.push_back(cell->cache());
+        assert(dynamic_cast<base_cache*>(cell->entity()));
+        m_caches.push_back(cell->cache());
       }
     } /* for(j..) */
   }   /* for(i..) */
-  return caches;
+  return m_caches;
 } /* caches() */
 
 void line_of_sight::cache_add(const std::shared_ptr<base_cache>& cache) {
-  auto los_caches = caches();
-  if (los_caches.end() ==
-      std::find(los_caches.begin(), los_caches.end(), cache)) {
-    m_caches.push_back(cache);
+  if (cache_in_view(cache)) {
+    return;
+  }
+  if (m_extra_caches.end() ==
+      std::find(m_extra_caches.begin(), m_extra_caches.end(), cache)) {
+    m_extra_caches.push_back(cache);
   }
 } /* cache_add() */
 
-__pure cell2D& line_of_sight::cell(size_t i, size_t j) const {
-  assert(i < m_view.shape()[0]);
-  assert(j < m_view.shape()[1]);
-  return *m_view[i][j];
+bool line_of_sight::cache_in_view(
+    const std::shared_ptr<base_cache>& cache) const {
+  rcppsw::math::dcoord2 ll = abs_ll();
+  rcppsw::math::dcoord2 loc = cache->discrete_loc();
+  if (loc.first < ll.first || loc.second < ll.second ||
+      loc.first - ll.first >= xsize() || loc.second - ll.second >= ysize()) {
+    return false;
+  }
+  const cell2D& host = cell(loc.first - ll.first, loc.second - ll.second);
+  return host.state_has_cache() && host.cache() == cache;
+} /* cache_in_view() */
+
+const los_delta& line_of_sight::delta(void) const {
+  if (!m_delta_valid) {
+    delta_calc();
+    m_delta_valid = true;
+  }
+  return m_delta;
+} /* delta() */
+
+void line_of_sight::delta_calc(void) const {
+  m_delta.entered.clear();
+  m_delta.left.clear();
+  m_delta.changed.clear();
+  m_delta.unchanged.clear();
+
+  sig_region region{true, abs_ll(), xsize(), ysize()};
+  m_next_sigs.resize(size());
+  for (size_t i = 0; i < xsize(); ++i) {
+    for (size_t j = 0; j < ysize(); ++j) {
+      const cell2D& c = cell(i, j);
+      cell_sig sig = cell_sig_calc(c);
+      m_next_sigs[region.index(c.loc())] = sig;
+
+      if (!m_sig_region.contains(c.loc())) {
+        m_delta.entered.emplace_back(i, j);
+      } else if (!(m_sigs[m_sig_region.index(c.loc())] == sig)) {
+        m_delta.changed.emplace_back(i, j);
+      } else if (nullptr != sig.entity) {
+        m_delta.unchanged.emplace_back(i, j);
+      }
+    } /* for(j..) */
+  }   /* for(i..) */
+
+  if (m_sig_region.valid) {
+    for (size_t i = 0; i < m_sig_region.xsize; ++i) {
+      for (size_t j = 0; j < m_sig_region.ysize; ++j) {
+        rcppsw::math::dcoord2 d(m_sig_region.ll.first + i,
+                                m_sig_region.ll.second + j);
+        if (!region.contains(d)) {
+          m_delta.left.push_back(d);
+        }
+      } /* for(j..) */
+    }   /* for(i..) */
+  }
+  std::swap(m_sigs, m_next_sigs);
+  m_sig_region = region;
+} /* delta_calc() */
+
+line_of_sight::cell_sig line_of_sight::cell_sig_calc(const cell2D& cell) {
+  if (!cell.state_has_block() && !cell.state_has_cache()) {
+    return {nullptr, -1, 0, 0};
+  }
+  const cell_entity* ent = cell.entity();
+  return {ent, ent->id(), ent->version(), cell.block_count()};
+} /* cell_sig_calc() */
+
+__pure const cell2D& line_of_sight::cell(size_t i, size_t j) const {
+  assert(i < xsize());
+  assert(j < ysize());
+  return *(*m_view)(i, j);
 }
 
 rcppsw::math::dcoord2 line_of_sight::abs_ll(void) const {
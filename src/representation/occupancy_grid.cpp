@@ -22,7 +22,15 @@
  * Includes
  ******************************************************************************/
 #include "fordyca/representation/occupancy_grid.hpp"
+#include <cmath>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/events/cell_unknown.hpp"
+#include "fordyca/metrics/tick_profiler.hpp"
 #include "fordyca/params/depth0/occupancy_grid_params.hpp"
 
 /*******************************************************************************
@@ -38,52 +46,127 @@ occupancy_grid::occupancy_grid(
     const struct params::depth0::occupancy_grid_params* c_params,
     const std::string& robot_id)
     : client(),
-      stacked_grid2(c_params->grid.resolution,
-                    static_cast<size_t>(c_params->grid.upper.GetX()),
-                    static_cast<size_t>(c_params->grid.upper.GetY())),
       m_pheromone_repeat_deposit(c_params->pheromone.repeat_deposit),
+      m_lazy_decay(c_params->pheromone.lazy_decay),
+      m_pheromone_rho(c_params->pheromone.rho),
+      m_resolution(c_params->grid.resolution),
       m_robot_id(robot_id),
-      m_server(std::move(server)) {
+      m_server(std::move(server)),
+      m_cells(grid_init(c_params)),
+      m_touched_cells(),
+      m_expiry(),
+      m_known_cells() {
   deferred_client_init(m_server);
   insmod("occupancy_grid", rcppsw::er::er_lvl::DIAG, rcppsw::er::er_lvl::NOM);
-  ER_NOM("%zu x%zu/%zu x %zu @ %f resolution",
-         stacked_grid2::xdsize(),
-         stacked_grid2::ydsize(),
-         stacked_grid2::xrsize(),
-         stacked_grid2::yrsize(),
-         stacked_grid2::resolution());
-
-  for (size_t i = 0; i < stacked_grid2::xdsize(); ++i) {
-    for (size_t j = 0; j < stacked_grid2::ydsize(); ++j) {
-      cell_init(i, j, c_params->pheromone.rho);
-    } /* for(j..) */
-  }   /* for(i..) */
+  ER_NOM("%zu x %zu @ %f resolution", xdsize(), ydsize(), m_resolution);
+
+  if (c_params->shared_baseline) {
+    ER_NOM("Sharing baseline grid");
+  }
+  if (m_lazy_decay) {
+    ER_NOM("Lazy pheromone decay enabled");
+  }
 }
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-void occupancy_grid::update(void) {
-#pragma omp parallel for
-  for (size_t i = 0; i < stacked_grid2::xdsize(); ++i) {
-    for (size_t j = 0; j < stacked_grid2::ydsize(); ++j) {
-      cell_update(i, j);
-    } /* for(j..) */
-  }   /* for(i..) */
+occupancy_grid::cell_grid occupancy_grid::grid_init(
+    const struct params::depth0::occupancy_grid_params* c_params) {
+  /* same as the discretization of the arena, so that the two line up */
+  size_t xdsize = static_cast<size_t>(
+      static_cast<size_t>(c_params->grid.upper.GetX()) /
+      c_params->grid.resolution);
+  size_t ydsize = static_cast<size_t>(
+      static_cast<size_t>(c_params->grid.upper.GetY()) /
+      c_params->grid.resolution);
+
+  if (c_params->shared_baseline) {
+    return baseline_grid(xdsize, ydsize, c_params->pheromone.rho);
+  }
+  return grid_build(xdsize, ydsize, c_params->pheromone.rho);
+} /* grid_init() */
+
+occupancy_grid::cell_grid occupancy_grid::grid_build(size_t xdsize,
+                                                     size_t ydsize,
+                                                     double pheromone_rho) {
+  return cell_grid(
+      xdsize, ydsize, [pheromone_rho](size_t i, size_t j, grid_cell& cell) {
+        std::get<kPheromoneLayer>(cell.layers).rho(pheromone_rho);
+        std::get<kCellLayer>(cell.layers).loc(rcppsw::math::dcoord2(i, j));
+      });
+} /* grid_build() */
+
+/*
+ * All robots whose grids have the same dimensions and decay rate start out
+ * with identical grids, so they are all copies of one baseline, which is
+ * kept for the lifetime of the process. The baseline allocates nothing up
+ * front; it shares its blank tiles, so each tile is initialized once, the
+ * first time any robot writes to it, and copied by every robot after that.
+ */
+const occupancy_grid::cell_grid& occupancy_grid::baseline_grid(
+    size_t xdsize,
+    size_t ydsize,
+    double pheromone_rho) {
+  static std::mutex mtx;
+  static std::map<std::tuple<size_t, size_t, double>, cell_grid> baselines;
+
+  std::lock_guard<std::mutex> lock(mtx);
+  auto key = std::make_tuple(xdsize, ydsize, pheromone_rho);
+  auto it = baselines.find(key);
+  if (it == baselines.end()) {
+    it = baselines.emplace(key, grid_build(xdsize, ydsize, pheromone_rho))
+             .first;
+    it->second.blank_tiles_share();
+  }
+  return it->second;
+} /* baseline_grid() */
+
+void occupancy_grid::update(uint timestep) {
+  metrics::phase_timer timer(metrics::tick_phase::kGRID_UPDATE);
+  if (m_lazy_decay) {
+    lazy_update(timestep);
+    return;
+  }
+  m_timestep = timestep;
+
+  /*
+   * Iterate backwards, so that cells removed from the known set when they
+   * expire (which swaps the last element into their slot) are not skipped.
+   */
+  for (size_t k = m_known_cells.size(); k > 0; --k) {
+    size_t index = m_known_cells[k - 1];
+    if (cell_update(index / ydsize(), index % ydsize())) {
+      known_cell_remove(index);
+    }
+  } /* for(k..) */
 } /* update() */
 
-void occupancy_grid::cell_init(size_t i, size_t j, double pheromone_rho) {
-  stacked_grid2::access<kPheromoneLayer>(i, j).rho(pheromone_rho);
-  cell2D& cell = stacked_grid2::access<kCellLayer>(i, j);
-  cell.robot_id(m_robot_id);
-  cell.loc(rcppsw::math::dcoord2(i, j));
-  cell.fsm().deferred_client_init(m_server);
-} /* cell_init() */
+void occupancy_grid::known_cell_add(size_t i, size_t j) {
+  grid_cell& cell = m_cells.access(i, j);
+  if (kNotKnown != cell.known_pos) {
+    return;
+  }
+  cell.known_pos = static_cast<uint32_t>(m_known_cells.size());
+  m_known_cells.push_back(cell_index(i, j));
+} /* known_cell_add() */
 
-void occupancy_grid::cell_update(size_t i, size_t j) {
-  rcppsw::swarm::pheromone_density& density =
-      stacked_grid2::access<kPheromoneLayer>(i, j);
-  cell2D& cell = stacked_grid2::access<kCellLayer>(i, j);
+void occupancy_grid::known_cell_remove(size_t index) {
+  grid_cell& cell = cell_at(index);
+  uint32_t pos = cell.known_pos;
+  if (kNotKnown == pos) {
+    return;
+  }
+  size_t last = m_known_cells.back();
+  m_known_cells[pos] = last;
+  cell_at(last).known_pos = pos;
+  m_known_cells.pop_back();
+  cell.known_pos = kNotKnown;
+} /* known_cell_remove() */
+
+bool occupancy_grid::cell_update(size_t i, size_t j) {
+  rcppsw::swarm::pheromone_density& density = access<kPheromoneLayer>(i, j);
+  cell2D& cell = access<kCellLayer>(i, j);
   if (!m_pheromone_repeat_deposit) {
     ER_ASSERT(density.last_result() <= 1.0,
               "FATAL: Repeat pheromone deposit detected");
@@ -97,7 +180,116 @@ void occupancy_grid::cell_update(size_t i, size_t j) {
            m_robot_id.c_str());
     events::cell_unknown op(cell.loc().first, cell.loc().second);
     cell.accept(op);
+    return true;
   }
+  return false;
 } /* cell_update() */
 
+rcppsw::swarm::pheromone_density& occupancy_grid::density(size_t i, size_t j) {
+  grid_cell& cell = m_cells.access(i, j);
+  rcppsw::swarm::pheromone_density& density =
+      std::get<kPheromoneLayer>(cell.layers);
+  if (!m_lazy_decay) {
+    return density;
+  }
+  size_t index = cell_index(i, j);
+  if (!cell.touched) {
+    /*
+     * Bring the density up to date with the last timestep the grid was
+     * updated, so that any deposits made this timestep behave exactly as they
+     * would if the grid was decayed every timestep.
+     */
+    double val = lazy_density_value(index);
+    density.reset();
+    density.pheromone_add(val);
+    density.calc();
+    cell.touched = 1;
+    m_touched_cells.push_back(index);
+  }
+  return density;
+} /* density() */
+
+rcppsw::swarm::pheromone_density occupancy_grid::density_current(
+    const rcppsw::math::dcoord2& d) const {
+  const grid_cell& cell = m_cells.access(d.first, d.second);
+  rcppsw::swarm::pheromone_density density =
+      std::get<kPheromoneLayer>(cell.layers);
+  if (!m_lazy_decay) {
+    return density;
+  }
+  size_t index = cell_index(d.first, d.second);
+  if (!cell.touched) {
+    double val = lazy_density_value(index);
+    density.reset();
+    density.pheromone_add(val);
+    density.calc();
+  }
+  return density;
+} /* density_current() */
+
+double occupancy_grid::lazy_density_value(size_t index) const {
+  const grid_cell& cell = cell_at(index);
+  return std::get<kPheromoneLayer>(cell.layers).last_result() *
+         std::pow(1.0 - m_pheromone_rho, m_timestep - cell.deposit_ts);
+} /* lazy_density_value() */
+
+void occupancy_grid::lazy_update(uint timestep) {
+  m_timestep = timestep;
+  for (size_t index : m_touched_cells) {
+    lazy_cell_update(index, timestep);
+    cell_at(index).touched = 0;
+  } /* for(index..) */
+  m_touched_cells.clear();
+
+  while (!m_expiry.empty() && m_expiry.top().expiry <= timestep) {
+    expiry_entry e = m_expiry.top();
+    m_expiry.pop();
+    if (cell_at(e.index).deposit_ts == e.deposit_ts) {
+      cell_expire(e.index);
+    }
+  } /* while(!m_expiry.empty()..) */
+} /* lazy_update() */
+
+void occupancy_grid::lazy_cell_update(size_t index, uint timestep) {
+  grid_cell& cell = cell_at(index);
+  rcppsw::swarm::pheromone_density& density =
+      std::get<kPheromoneLayer>(cell.layers);
+  if (!m_pheromone_repeat_deposit) {
+    ER_ASSERT(density.last_result() <= 1.0,
+              "FATAL: Repeat pheromone deposit detected");
+  }
+  double val = density.calc();
+  cell.deposit_ts = timestep;
+
+  /*
+   * Compute the first timestep at which the density will be below the
+   * relevance threshold: val * (1 - rho)^k < epsilon.
+   */
+  uint expiry = timestep;
+  if (val >= kEpsilon) {
+    if (m_pheromone_rho >= 1.0) {
+      expiry = timestep + 1;
+    } else {
+      double k = std::floor(std::log(kEpsilon / val) /
+                            std::log(1.0 - m_pheromone_rho)) +
+                 1.0;
+      double limit = std::numeric_limits<uint>::max() - timestep;
+      expiry = timestep + static_cast<uint>(std::min(k, limit));
+    }
+  }
+  m_expiry.push({expiry, timestep, index});
+} /* lazy_cell_update() */
+
+void occupancy_grid::cell_expire(size_t index) {
+  cell2D& cell = std::get<kCellLayer>(cell_at(index).layers);
+  ER_VER("Relevance of cell(%zu, %zu) is within %f of 0 for %s",
+         cell.loc().first,
+         cell.loc().second,
+         kEpsilon,
+         m_robot_id.c_str());
+  events::cell_unknown op(cell.loc().first, cell.loc().second);
+  cell.accept(op);
+  known_cell_remove(index);
+} /* cell_expire() */
+
 NS_END(representation, fordyca);
@@ -23,6 +23,7 @@
  ******************************************************************************/
 #include "fordyca/representation/perceived_arena_map.hpp"
 
+#include "fordyca/er/er_profile.hpp"
 #include "fordyca/events/cell_empty.hpp"
 #include "fordyca/params/depth0/occupancy_grid_params.hpp"
 #include "fordyca/representation/base_cache.hpp"
@@ -60,8 +61,8 @@ perceived_arena_map::perceived_block_list perceived_arena_map::perceived_blocks(
   perceived_block_list pblocks;
 
   for (auto& b : m_blocks) {
-    pblocks.push_back(perceived_block(
-        b, m_grid.access<occupancy_grid::kPheromoneLayer>(b->discrete_loc())));
+    pblocks.push_back(
+        perceived_block(b, m_grid.density_current(b->discrete_loc())));
   } /* for(&b..) */
   return pblocks;
 } /* blocks() */
@@ -71,58 +72,58 @@ perceived_arena_map::perceived_cache_list perceived_arena_map::perceived_caches(
   perceived_cache_list pcaches;
 
   for (auto& c : m_caches) {
-    pcaches.push_back(perceived_cache(
-        c, m_grid.access<occupancy_grid::kPheromoneLayer>(c->discrete_loc())));
+    pcaches.push_back(
+        perceived_cache(c, m_grid.density_current(c->discrete_loc())));
   } /* for(c..) */
   return pcaches;
 } /* caches() */
 
 void perceived_arena_map::cache_add(const std::shared_ptr<base_cache>& cache) {
   cache_remove(cache);
-  m_caches.push_back(cache);
+  m_caches.add(cache);
 } /* cache_add() */
 
 void perceived_arena_map::cache_remove(const std::shared_ptr<base_cache>& victim) {
-  for (auto it = m_caches.begin(); it != m_caches.end(); ++it) {
-    if (*(*it) == *victim) {
-      events::cell_empty op(victim->discrete_loc().first,
-                            victim->discrete_loc().second);
-      m_grid.access<occupancy_grid::kCellLayer>(victim->discrete_loc()).accept(op);
-      m_caches.erase(it);
-      return;
-    }
-  } /* for(it..) */
+  /* caches are equal iff they occupy the same location */
+  std::shared_ptr<base_cache> known =
+      m_caches.find_by_loc(victim->discrete_loc());
+  if (nullptr == known) {
+    return;
+  }
+  events::cell_empty op(known->discrete_loc().first,
+                        known->discrete_loc().second);
+  m_grid.access<occupancy_grid::kCellLayer>(known->discrete_loc()).accept(op);
+  m_caches.remove_by_loc(known->discrete_loc());
 } /* cache_remove() */
 
 bool perceived_arena_map::block_add(const std::shared_ptr<block>& block_in) {
-  auto it1 =
-      std::find_if(m_blocks.begin(),
-                   m_blocks.end(),
-                   [&block_in](const std::shared_ptr<representation::block>& b) {
-                     return b->id() == block_in->id();
-                   });
-  auto it2 =
-      std::find_if(m_blocks.begin(),
-                   m_blocks.end(),
-                   [&block_in](const std::shared_ptr<representation::block>& b) {
-                     return b->discrete_loc() == block_in->discrete_loc();
-                   });
-
-  if (m_blocks.end() != it1) { /* block is known */
+  std::shared_ptr<block> known = m_blocks.find_by_id(block_in->id());
+  std::shared_ptr<block> at_loc =
+      m_blocks.find_by_loc(block_in->discrete_loc());
+
+  if (nullptr != known) { /* block is known */
     /*
      * Unless a given block's location has changed, there is no need to update
      * the state of the world.
      */
-    if (block_in->discrete_loc() != (*it1)->discrete_loc()) {
+    if (block_in->discrete_loc() != known->discrete_loc()) {
       ER_VER("block%d has moved: (%zu, %zu) -> (%zu, %zu)",
              block_in->id(),
-             (*it1)->discrete_loc().first,
-             (*it1)->discrete_loc().second,
+             known->discrete_loc().first,
+             known->discrete_loc().second,
              block_in->discrete_loc().first,
              block_in->discrete_loc().second);
       int id = block_in->id();
-      block_remove(*it1);
-      m_blocks.push_back(block_in);
+      block_remove(known);
+
+      /*
+       * A different block may be tracked where the block moved to, which is
+       * out of date information about the arena, just as below.
+       */
+      if (nullptr != at_loc) {
+        block_remove(at_loc);
+      }
+      m_blocks.add(block_in);
       ER_VER("Add block%d (n_blocks=%zu)", id, m_blocks.size());
       return true;
     }
@@ -132,15 +133,15 @@ bool perceived_arena_map::block_add(const std::shared_ptr<block>& block_in) {
      * so the old block needs to be removed, as it is out of date information
      * about the arena.
      */
-    if (it2 != m_blocks.end()) {
+    if (nullptr != at_loc) {
       ER_VER("Remove old block%d@(%zu, %zu): new block%d found there",
-             (*it2)->id(),
+             at_loc->id(),
              block_in->discrete_loc().first,
              block_in->discrete_loc().second,
              block_in->id());
-      block_remove(*it2);
+      block_remove(at_loc);
     }
-    m_blocks.push_back(block_in);
+    m_blocks.add(block_in);
     ER_VER("Add block%d (n_blocks=%zu)", block_in->id(), m_blocks.size());
     return true;
   }
@@ -148,17 +149,26 @@ bool perceived_arena_map::block_add(const std::shared_ptr<block>& block_in) {
 } /* block_add() */
 
 bool perceived_arena_map::block_remove(const std::shared_ptr<block>& victim) {
-  for (auto it = m_blocks.begin(); it != m_blocks.end(); ++it) {
-    if (*(*it) == *victim) {
-      ER_VER("Remove block%d", victim->id());
-      events::cell_empty op(victim->discrete_loc().first,
-                            victim->discrete_loc().second);
-      m_grid.access<occupancy_grid::kCellLayer>(victim->discrete_loc()).accept(op);
-      m_blocks.erase(it);
-      return true;
-    }
-  } /* for(it..) */
-  return false;
+  /* blocks are equal iff they have the same ID */
+  std::shared_ptr<block> known = m_blocks.find_by_id(victim->id());
+  if (nullptr == known) {
+    return false;
+  }
+  ER_VER("Remove block%d", victim->id());
+  events::cell_empty op(known->discrete_loc().first,
+                        known->discrete_loc().second);
+  m_grid.access<occupancy_grid::kCellLayer>(known->discrete_loc()).accept(op);
+  m_blocks.remove_by_id(known->id());
+  return true;
 } /* block_remove() */
 
+void perceived_arena_map::density_refresh(const rcppsw::math::dcoord2& d) {
+  rcppsw::swarm::pheromone_density& density = m_grid.density(d.first, d.second);
+  if (m_grid.pheromone_repeat_deposit()) {
+    density.pheromone_add(1.0);
+  } else {
+    density.pheromone_set(1.0);
+  }
+} /* density_refresh() */
+
 NS_END(representation, fordyca);
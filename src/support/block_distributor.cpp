@@ -22,8 +22,10 @@
  * Includes
  ******************************************************************************/
 #include "fordyca/support/block_distributor.hpp"
+#include <algorithm>
+#include <cmath>
+
 #include "fordyca/params/block_params.hpp"
-#include "fordyca/representation/block.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -39,6 +41,7 @@ block_distributor::block_distributor(argos::CRange<double> arena_x,
                                      argos::CRange<double> nest_y,
                                      const struct params::block_params* params)
     : m_dist_model(params->dist_model),
+      m_block_dim(params->dimension),
       m_arena_x(arena_x),
       m_arena_y(arena_y),
       m_nest_x(nest_x),
@@ -48,30 +51,143 @@ block_distributor::block_distributor(argos::CRange<double> arena_x,
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-bool block_distributor::distribute_block(const representation::block& block,
-                                         argos::CVector2* const coord) {
+void block_distributor::grid_init(size_t xdsize,
+                                  size_t ydsize,
+                                  double resolution) {
+  m_region.clear();
   if (m_dist_model == "random") {
-    *coord = dist_random(block);
-    return true;
+    random_region_init(xdsize, ydsize, resolution);
   } else if (m_dist_model == "single_source") {
-    *coord = dist_single_src(block);
-    return true;
+    single_src_region_init(xdsize, ydsize, resolution);
   }
-  return false;
-} /* distribute_block() */
 
-argos::CVector2 block_distributor::dist_random(
-    const representation::block& block) {
-  return dist_outside_range(block.xsize(), m_nest_x, m_nest_y);
-} /* dist_random() */
+  size_t n_cells = 0;
+  for (auto& r : m_region) {
+    n_cells += (r.xmax - r.xmin) * (r.ymax - r.ymin);
+  } /* for(&r..) */
+  m_n_free = n_cells;
+
+  /* build the tree in O(# chunks), rather than adding each chunk to it */
+  size_t n_chunks = (n_cells + kCHUNK_CELLS - 1) >> kCHUNK_BITS;
+  m_filled.clear();
+  m_filled.resize(n_chunks);
+  m_chunk_free.assign(n_chunks + 1, 0);
+  for (size_t i = 1; i <= n_chunks; ++i) {
+    m_chunk_free[i] +=
+        std::min(kCHUNK_CELLS, n_cells - ((i - 1) << kCHUNK_BITS));
+    size_t parent = i + (i & -i);
+    if (parent <= n_chunks) {
+      m_chunk_free[parent] += m_chunk_free[i];
+    }
+  } /* for(i..) */
+} /* grid_init() */
+
+void block_distributor::cell_update(const rcppsw::math::dcoord2& d,
+                                    bool free) {
+  size_t number;
+  if (!cell_number(d, &number)) {
+    return;
+  }
+  size_t chunk = number >> kCHUNK_BITS;
+  size_t bit = number & (kCHUNK_CELLS - 1);
+  uint64_t mask = uint64_t(1) << (bit & 63);
+  std::unique_ptr<chunk_bitmap>& filled = m_filled[chunk];
+
+  if (free) {
+    if (filled && ((*filled)[bit >> 6] & mask)) {
+      (*filled)[bit >> 6] &= ~mask;
+      chunk_free_update(chunk, true);
+      ++m_n_free;
+    }
+  } else {
+    if (!filled) {
+      filled = rcppsw::make_unique<chunk_bitmap>();
+      filled->fill(0);
+    }
+    if (!((*filled)[bit >> 6] & mask)) {
+      (*filled)[bit >> 6] |= mask;
+      chunk_free_update(chunk, false);
+      --m_n_free;
+    }
+  }
+} /* cell_update() */
+
+bool block_distributor::distribute_block(const representation::block&,
+                                         rcppsw::math::dcoord2* const coord) {
+  if (!distributing() || 0 == m_n_free) {
+    return false;
+  }
+  size_t n = m_rng->Uniform(argos::CRange<argos::UInt32>(
+      0, static_cast<argos::UInt32>(m_n_free)));
+  size_t chunk = chunk_find(&n);
+  const std::unique_ptr<chunk_bitmap>& filled = m_filled[chunk];
+  size_t bit = n;
+
+  /*
+   * With no filled cells, the chunk's n-th free cell is its n-th cell.
+   * Otherwise, find the word containing it, then the cell within the word.
+   */
+  if (filled) {
+    size_t word = 0;
+    size_t n_free = 64 - __builtin_popcountll((*filled)[word]);
+    while (n >= n_free) {
+      n -= n_free;
+      n_free = 64 - __builtin_popcountll((*filled)[++word]);
+    } /* while() */
+    uint64_t free_bits = ~(*filled)[word];
+    for (size_t i = 0; i < n; ++i) {
+      free_bits &= free_bits - 1;
+    } /* for(i..) */
+    bit = (word << 6) + __builtin_ctzll(free_bits);
+  }
+  *coord = cell_coord((chunk << kCHUNK_BITS) + bit);
+  return true;
+} /* distribute_block() */
 
 __pure argos::CRange<double> block_distributor::single_src_xrange(void) {
   return argos::CRange<double>(m_arena_x.GetMax() * 0.9 - 0.75,
                                m_arena_x.GetMax() * 0.9);
 } /* single_src_xrange() */
 
-argos::CVector2 block_distributor::dist_single_src(
-    const representation::block& block) {
+void block_distributor::random_region_init(size_t xdsize,
+                                           size_t ydsize,
+                                           double resolution) {
+  /*
+   * Anywhere that is not too close to the arena walls, and is not on/right
+   * next to the nest.
+   */
+  argos::CRange<double> x_range(m_arena_x.GetMin() + m_block_dim * 4,
+                                m_arena_x.GetMax() - m_block_dim * 4);
+  argos::CRange<double> y_range(m_arena_y.GetMin() + m_block_dim * 4,
+                                m_arena_y.GetMax() - m_block_dim * 4);
+  argos::CRange<double> nest_x(m_nest_x.GetMin() - m_block_dim,
+                               m_nest_x.GetMax() + m_block_dim);
+  argos::CRange<double> nest_y(m_nest_y.GetMin() - m_block_dim,
+                               m_nest_y.GetMax() + m_block_dim);
+
+  cell_span x = axis_cells(x_range, resolution, xdsize);
+  cell_span y = axis_cells(y_range, resolution, ydsize);
+  cell_span hole_x = axis_cells(nest_x, resolution, xdsize);
+  cell_span hole_y = axis_cells(nest_y, resolution, ydsize);
+
+  /* clip the nest to the region, so the strips around it do not overlap */
+  hole_x.first = std::min(std::max(hole_x.first, x.first), x.second);
+  hole_x.second = std::min(std::max(hole_x.second, hole_x.first), x.second);
+  hole_y.first = std::min(std::max(hole_y.first, y.first), y.second);
+  hole_y.second = std::min(std::max(hole_y.second, hole_y.first), y.second);
+  if (hole_x.first == hole_x.second || hole_y.first == hole_y.second) {
+    rect_add(x, y);
+    return;
+  }
+  rect_add({x.first, hole_x.first}, y);
+  rect_add({hole_x.second, x.second}, y);
+  rect_add(hole_x, {y.first, hole_y.first});
+  rect_add(hole_x, {hole_y.second, y.second});
+} /* random_region_init() */
+
+void block_distributor::single_src_region_init(size_t xdsize,
+                                               size_t ydsize,
+                                               double resolution) {
   /*
    * Find the 90% point between the nest and the source along the X (horizontal)
    * direction, and put all the blocks around there.
@@ -80,36 +196,109 @@ argos::CVector2 block_distributor::dist_single_src(
                                 std::min(m_arena_y.GetMax() - 1.0,
                                          m_nest_y.GetMax() + 1.0));
   argos::CRange<double> x_range = single_src_xrange();
-  x_range.Set(x_range.GetMin() - block.xsize(),
-              x_range.GetMax() + block.xsize());
-  y_range.Set(y_range.GetMin() - block.xsize(),
-              y_range.GetMax() + block.xsize());
-
-  return dist_in_range(x_range, y_range);
-} /* dist_single_src() */
-
-argos::CVector2 block_distributor::dist_in_range(argos::CRange<double> x_range,
-                                                 argos::CRange<double> y_range) {
-  return argos::CVector2(m_rng->Uniform(x_range), m_rng->Uniform(y_range));
-} /* dist_in_range() */
-
-argos::CVector2 block_distributor::dist_outside_range(
-    double dimension,
-    argos::CRange<double> x_range,
-    argos::CRange<double> y_range) {
-  double x, y;
-  x_range.Set(x_range.GetMin() - dimension, x_range.GetMax() + dimension);
-  y_range.Set(y_range.GetMin() - dimension, y_range.GetMax() + dimension);
-  do {
-    x = m_rng->Uniform(
-        argos::CRange<double>(m_arena_x.GetMin() + dimension * 4,
-                              m_arena_x.GetMax() - dimension * 4));
-    y = m_rng->Uniform(
-        argos::CRange<double>(m_arena_y.GetMin() + dimension * 4,
-                              m_arena_y.GetMax() - dimension * 4));
-  } while (x_range.WithinMinBoundIncludedMaxBoundIncluded(x) &&
-           y_range.WithinMinBoundIncludedMaxBoundIncluded(y));
-  return argos::CVector2(x, y);
-} /* dist_outside_range() */
+  x_range.Set(x_range.GetMin() - m_block_dim, x_range.GetMax() + m_block_dim);
+  y_range.Set(y_range.GetMin() - m_block_dim, y_range.GetMax() + m_block_dim);
+
+  rect_add(axis_cells(x_range, resolution, xdsize),
+           axis_cells(y_range, resolution, ydsize));
+} /* single_src_region_init() */
+
+block_distributor::cell_span block_distributor::axis_cells(
+    const argos::CRange<double>& range,
+    double resolution,
+    size_t n) {
+  auto within = [&](size_t i) {
+    return range.WithinMinBoundIncludedMaxBoundIncluded(i * resolution);
+  };
+  if (range.GetMax() < 0.0 || 0 == n) {
+    return {0, 0};
+  }
+  /*
+   * Start from the rounded bounds, then correct them against the same test
+   * cell centers used to be checked with one at a time.
+   */
+  double low = std::max(0.0, std::ceil(range.GetMin() / resolution));
+  double high = std::floor(range.GetMax() / resolution) + 1.0;
+  size_t ilow = static_cast<size_t>(std::min(low, static_cast<double>(n)));
+  size_t ihigh = static_cast<size_t>(std::min(high, static_cast<double>(n)));
+  while (ilow > 0 && within(ilow - 1)) {
+    --ilow;
+  } /* while() */
+  while (ilow < n && !within(ilow)) {
+    ++ilow;
+  } /* while() */
+  ihigh = std::max(ihigh, ilow);
+  while (ihigh < n && within(ihigh)) {
+    ++ihigh;
+  } /* while() */
+  while (ihigh > ilow && !within(ihigh - 1)) {
+    --ihigh;
+  } /* while() */
+  return {ilow, ihigh};
+} /* axis_cells() */
+
+void block_distributor::rect_add(cell_span x, cell_span y) {
+  if (x.first >= x.second || y.first >= y.second) {
+    return;
+  }
+  size_t first = 0;
+  if (!m_region.empty()) {
+    const cell_rect& last = m_region.back();
+    first = last.first + (last.xmax - last.xmin) * (last.ymax - last.ymin);
+  }
+  m_region.push_back({x.first, x.second, y.first, y.second, first});
+} /* rect_add() */
+
+bool block_distributor::cell_number(const rcppsw::math::dcoord2& d,
+                                    size_t* number) const {
+  for (auto& r : m_region) {
+    if (d.first >= r.xmin && d.first < r.xmax && d.second >= r.ymin &&
+        d.second < r.ymax) {
+      *number = r.first + (d.first - r.xmin) * (r.ymax - r.ymin) +
+                (d.second - r.ymin);
+      return true;
+    }
+  } /* for(&r..) */
+  return false;
+} /* cell_number() */
+
+rcppsw::math::dcoord2 block_distributor::cell_coord(size_t number) const {
+  size_t i = m_region.size() - 1;
+  while (m_region[i].first > number) {
+    --i;
+  } /* while() */
+  const cell_rect& r = m_region[i];
+  size_t offset = number - r.first;
+  return rcppsw::math::dcoord2(r.xmin + offset / (r.ymax - r.ymin),
+                               r.ymin + offset % (r.ymax - r.ymin));
+} /* cell_coord() */
+
+void block_distributor::chunk_free_update(size_t chunk, bool freed) {
+  for (size_t i = chunk + 1; i < m_chunk_free.size(); i += i & -i) {
+    if (freed) {
+      ++m_chunk_free[i];
+    } else {
+      --m_chunk_free[i];
+    }
+  } /* for(i..) */
+} /* chunk_free_update() */
+
+size_t block_distributor::chunk_find(size_t* n) const {
+  size_t n_chunks = m_chunk_free.size() - 1;
+  size_t step = 1;
+  while (step * 2 <= n_chunks) {
+    step *= 2;
+  } /* while() */
+
+  /* descend the tree, skipping whole subtrees with <= n free cells */
+  size_t pos = 0;
+  for (; step > 0; step >>= 1) {
+    if (pos + step <= n_chunks && m_chunk_free[pos + step] <= *n) {
+      pos += step;
+      *n -= m_chunk_free[pos];
+    }
+  } /* for(step..) */
+  return pos;
+} /* chunk_find() */
 
 NS_END(support, fordyca);
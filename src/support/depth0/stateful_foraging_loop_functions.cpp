@@ -34,6 +34,7 @@
 #include "fordyca/metrics/fsm/stateful_metrics_collector.hpp"
 #include "fordyca/metrics/fsm/stateless_metrics.hpp"
 #include "fordyca/metrics/fsm/stateless_metrics_collector.hpp"
+#include "fordyca/metrics/tick_profiler.hpp"
 #include "fordyca/params/loop_function_repository.hpp"
 #include "fordyca/params/loop_functions_params.hpp"
 #include "fordyca/params/output_params.hpp"
@@ -64,81 +65,74 @@ void stateful_foraging_loop_functions::Init(argos::TConfigurationNode& node) {
   /* initialize stat collecting */
   auto* p_output = static_cast<const struct params::output_params*>(
       repo.get_params("output"));
-  collector_group().register_collector<metrics::fsm::stateful_metrics_collector>(
-      "fsm::stateful",
-      metrics_path() + "/" + p_output->metrics.stateful_fname,
-      p_output->metrics.collect_interval);
+  m_stateful_collector =
+      collector_register<metrics::fsm::stateful_metrics_collector>(
+          "fsm::stateful",
+          metrics_path() + "/" + p_output->metrics.stateful_fname,
+          p_output->metrics.collect_interval);
   collector_group().reset_all();
 
   /* configure robots */
-  for (auto& entity_pair : GetSpace().GetEntitiesByType("foot-bot")) {
-    argos::CFootBotEntity& robot =
-        *argos::any_cast<argos::CFootBotEntity*>(entity_pair.second);
-    auto& controller =
-        dynamic_cast<controller::depth0::stateful_foraging_controller&>(
-            robot.GetControllableEntity().GetController());
-    auto* l_params = static_cast<const struct params::loop_functions_params*>(
-        repo.get_params("loop_functions"));
-
-    controller.display_los(l_params->display_robot_los);
-    utils::set_robot_los<controller::depth0::stateful_foraging_controller>(
-        robot, *arena_map());
-  } /* for(entity..) */
+  auto* l_params = static_cast<const struct params::loop_functions_params*>(
+      repo.get_params("loop_functions"));
+  m_robots.build(GetSpace());
+  for (auto& r : m_robots) {
+    r.controller->display_los(l_params->display_robot_los);
+    utils::set_robot_los(*r.robot, *r.controller, *arena_map());
+  } /* for(&r..) */
   ER_NOM("stateful_foraging loop functions initialization finished");
 }
 
-void stateful_foraging_loop_functions::pre_step_iter(
-    argos::CFootBotEntity& robot) {
-  auto& controller =
-      static_cast<controller::depth0::stateful_foraging_controller&>(
-          robot.GetControllableEntity().GetController());
-
-  /* get stats from this robot before its state changes */
-  collector_group().collect_from(
-      "fsm::distance", static_cast<metrics::fsm::distance_metrics&>(controller));
-  if (controller.current_task()) {
-    collector_group().collect_from("fsm::stateful",
-                                   static_cast<metrics::fsm::stateless_metrics&>(
-                                       *controller.current_task()));
+void stateful_foraging_loop_functions::Reset(void) {
+  stateless_foraging_loop_functions::Reset();
+  m_robots.build(GetSpace());
+} /* Reset() */
+
+void stateful_foraging_loop_functions::pre_step_metrics(
+    const robot_registry<controller_type>::entry& r) {
+  distance_collector().collect(
+      static_cast<metrics::fsm::distance_metrics&>(*r.controller));
+  if (r.controller->current_task()) {
+    m_stateful_collector.collect(static_cast<metrics::fsm::stateless_metrics&>(
+        *r.controller->current_task()));
   }
+} /* pre_step_metrics() */
 
-  /* Send the robot its new line of sight */
-  utils::set_robot_pos<controller::depth0::stateful_foraging_controller>(robot);
-  utils::set_robot_los<controller::depth0::stateful_foraging_controller>(
-      robot, *arena_map());
-  set_robot_tick<controller::depth0::stateful_foraging_controller>(robot);
-
-  /* Now watch it react to the environment */
-  interactor(rcppsw::er::g_server,
-             arena_map(),
-             floor())(controller,
-                      static_cast<metrics::block_metrics_collector&>(
-                          *collector_group()["block"]));
-} /* pre_step_iter() */
+void stateful_foraging_loop_functions::pre_step_sense(
+    const robot_registry<controller_type>::entry& r) {
+  utils::set_robot_pos(*r.robot, *r.controller);
+  utils::set_robot_los(*r.robot, *r.controller, *arena_map());
+  set_robot_tick(*r.controller);
+} /* pre_step_sense() */
 
-argos::CColor stateful_foraging_loop_functions::GetFloorColor(
-    const argos::CVector2& plane_pos) {
-  /* The nest is a light gray */
-  if (nest_xrange().WithinMinBoundIncludedMaxBoundIncluded(plane_pos.GetX()) &&
-      nest_yrange().WithinMinBoundIncludedMaxBoundIncluded(plane_pos.GetY())) {
-    return argos::CColor::GRAY70;
-  }
+void stateful_foraging_loop_functions::pre_step_iter(
+    const robot_registry<controller_type>::entry& r) {
+  metrics::phase_timer timer(metrics::tick_phase::kARENA_INTERACT);
+  interactor(rcppsw::er::g_server, arena_map(), floor())(*r.controller,
+                                                        *block_collector());
+} /* pre_step_iter() */
 
-  for (size_t i = 0; i < arena_map()->blocks().size(); ++i) {
-    if (arena_map()->blocks()[i]->contains_point(plane_pos)) {
-      return argos::CColor::BLACK;
-    }
+/*
+ * Same two phases as \ref stateless_foraging_loop_functions::PreStep(). The
+ * parts of the arena grid robot LOS cover are allocated up front, so that LOS
+ * construction only reads the arena, and so can be done in parallel.
+ */
+void stateful_foraging_loop_functions::PreStep() {
+  for (auto& r : m_robots) {
+    pre_step_metrics(r);
+    utils::robot_los_allocate(*r.robot, *arena_map());
+  } /* for(&r..) */
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (size_t i = 0; i < m_robots.size(); ++i) {
+    pre_step_sense(m_robots[i]);
   } /* for(i..) */
 
-  return argos::CColor::WHITE;
-} /* GetFloorColor() */
-
-void stateful_foraging_loop_functions::PreStep() {
-  for (auto& entity_pair : GetSpace().GetEntitiesByType("foot-bot")) {
-    argos::CFootBotEntity& robot =
-        *argos::any_cast<argos::CFootBotEntity*>(entity_pair.second);
-    pre_step_iter(robot);
-  } /* for(&entity..) */
+  for (auto& r : m_robots) {
+    pre_step_iter(r);
+  } /* for(&r..) */
   pre_step_final();
 } /* PreStep() */
 
@@ -34,10 +34,13 @@
 #include "fordyca/metrics/block_metrics_collector.hpp"
 #include "fordyca/metrics/fsm/distance_metrics_collector.hpp"
 #include "fordyca/metrics/fsm/stateless_metrics_collector.hpp"
+#include "fordyca/metrics/tick_profiler.hpp"
 #include "fordyca/params/arena_map_params.hpp"
 #include "fordyca/params/loop_function_repository.hpp"
 #include "fordyca/params/loop_functions_params.hpp"
 #include "fordyca/params/output_params.hpp"
+#include "fordyca/params/profiling_params.hpp"
+#include "fordyca/params/shared_repository.hpp"
 #include "fordyca/representation/cell2D.hpp"
 #include "fordyca/support/depth0/arena_interactor.hpp"
 #include "fordyca/tasks/foraging_task.hpp"
@@ -60,7 +63,10 @@ stateless_foraging_loop_functions::stateless_foraging_loop_functions(void)
       m_nest_y(),
       m_output_root(),
       m_metrics_path(),
+      m_profile_fname(),
+      m_profile_hist_fname(),
       m_collector_group(),
+      m_metrics_writer(kMETRICS_QUEUE_DEPTH),
       m_arena_map() {
   insmod("loop_functions", rcppsw::er::er_lvl::DIAG, rcppsw::er::er_lvl::NOM);
 }
@@ -107,82 +113,100 @@ void stateless_foraging_loop_functions::Init(argos::TConfigurationNode& node) {
 
   /* initialize metric collecting */
   metric_collecting_init(p_output);
+  profiling_init(static_cast<const struct params::profiling_params*>(
+      repo.get_params("profiling")));
 
   /* configure robots */
-  for (auto& entity_pair : GetSpace().GetEntitiesByType("foot-bot")) {
-    argos::CFootBotEntity& robot =
-        *argos::any_cast<argos::CFootBotEntity*>(entity_pair.second);
-    auto& controller = static_cast<controller::base_foraging_controller&>(
-        robot.GetControllableEntity().GetController());
-    controller.display_id(l_params->display_robot_id);
-  } /* for(&robot..) */
+  m_robots.build(GetSpace());
+  for (auto& r : m_robots) {
+    r.controller->display_id(l_params->display_robot_id);
+  } /* for(&r..) */
   ER_NOM("Stateless foraging loop functions initialization finished");
 }
 
 void stateless_foraging_loop_functions::Reset() {
+  m_robots.build(GetSpace());
   m_collector_group.reset_all();
+  metrics::tick_profiler::instance().reset();
   m_arena_map->distribute_blocks();
 }
 
 void stateless_foraging_loop_functions::Destroy() {
+  /* all queued rows must be on disk before the collectors are finalized */
+  m_metrics_writer.drain();
   m_collector_group.finalize_all();
+
+  auto& profiler = metrics::tick_profiler::instance();
+  if (profiler.enabled()) {
+    profiler.write(m_profile_fname, m_profile_hist_fname);
+    profiler.enabled(false);
+  }
+
+  /* the next experiment in this process may load a different document */
+  params::shared_repository::release(
+      argos::CSimulator::GetInstance().GetConfigurationRoot());
 }
 
 argos::CColor stateless_foraging_loop_functions::GetFloorColor(
     const argos::CVector2& plane_pos) {
-  /* The nest is a light gray */
-  if (m_nest_x.WithinMinBoundIncludedMaxBoundIncluded(plane_pos.GetX()) &&
-      m_nest_y.WithinMinBoundIncludedMaxBoundIncluded(plane_pos.GetY())) {
-    return argos::CColor::GRAY70;
-  }
+  metrics::phase_timer timer(metrics::tick_phase::kFLOOR_COLOR);
+  return arena_map()->floor_color(plane_pos);
+} /* GetFloorColor() */
 
-  for (auto& block : arena_map()->blocks()) {
-    if (block->contains_point(plane_pos)) {
-      return block->color();
-    }
-  } /* for(&block..) */
+void stateless_foraging_loop_functions::pre_step_metrics(
+    const robot_registry<controller_type>::entry& r) {
+  m_distance_collector.collect(
+      static_cast<metrics::fsm::distance_metrics&>(*r.controller));
+  m_stateless_collector.collect(
+      static_cast<metrics::fsm::stateless_metrics&>(*r.controller->fsm()));
+} /* pre_step_metrics() */
 
-  return argos::CColor::WHITE;
-} /* GetFloorColor() */
+void stateless_foraging_loop_functions::pre_step_sense(
+    const robot_registry<controller_type>::entry& r) {
+  set_robot_tick(*r.controller);
+  utils::set_robot_pos(*r.robot, *r.controller);
+} /* pre_step_sense() */
 
 void stateless_foraging_loop_functions::pre_step_iter(
-    argos::CFootBotEntity& robot) {
-  auto& controller =
-      static_cast<controller::depth0::stateless_foraging_controller&>(
-          robot.GetControllableEntity().GetController());
-
-  /* get stats from this robot before its state changes */
-  m_collector_group.collect_from(
-      "fsm::distance", static_cast<metrics::fsm::distance_metrics&>(controller));
-  m_collector_group.collect_from("fsm::stateless",
-                                 static_cast<metrics::fsm::stateless_metrics&>(
-                                     *controller.fsm()));
-
-  /* Send the robot its current position */
-  set_robot_tick<controller::depth0::stateless_foraging_controller>(robot);
-  utils::set_robot_pos<controller::depth0::stateless_foraging_controller>(robot);
-
-  /* Now watch it react to the environment */
-  interactor(rcppsw::er::g_server,
-             m_arena_map,
-             floor())(controller,
-                      static_cast<metrics::block_metrics_collector&>(
-                          *m_collector_group["block"]));
+    const robot_registry<controller_type>::entry& r) {
+  metrics::phase_timer timer(metrics::tick_phase::kARENA_INTERACT);
+  interactor(rcppsw::er::g_server, m_arena_map, floor())(*r.controller,
+                                                        *m_block_collector);
 } /* pre_step_iter() */
 
 void stateless_foraging_loop_functions::pre_step_final(void) {
-  m_collector_group.metrics_write_all(GetSpace().GetSimulationClock());
+  {
+    metrics::phase_timer timer(metrics::tick_phase::kMETRICS_WRITE);
+    m_collector_group.metrics_write_all(GetSpace().GetSimulationClock());
+  }
   m_collector_group.timestep_reset_all();
   m_collector_group.interval_reset_all();
   m_collector_group.timestep_inc_all();
 } /* pre_step_final() */
 
+/*
+ * PreStep() is split into two phases. First, each robot has its stats
+ * collected (before its state changes), and is then sent its current
+ * position. Robots only modify their own state in the second part of this,
+ * so it is done in parallel. Second, robots interact with the arena, which
+ * changes shared state, so it is done serially in robot index order, which
+ * keeps runs reproducible regardless of the number of threads.
+ */
 void stateless_foraging_loop_functions::PreStep() {
-  for (auto& entity_pair : GetSpace().GetEntitiesByType("foot-bot")) {
-    argos::CFootBotEntity& robot =
-        *argos::any_cast<argos::CFootBotEntity*>(entity_pair.second);
-    pre_step_iter(robot);
-  } /* for(&entity..) */
+  for (auto& r : m_robots) {
+    pre_step_metrics(r);
+  } /* for(&r..) */
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (size_t i = 0; i < m_robots.size(); ++i) {
+    pre_step_sense(m_robots[i]);
+  } /* for(i..) */
+
+  for (auto& r : m_robots) {
+    pre_step_iter(r);
+  } /* for(&r..) */
   pre_step_final();
 } /* PreStep() */
 
@@ -194,23 +218,40 @@ void stateless_foraging_loop_functions::metric_collecting_init(
   }
   fs::create_directories(m_metrics_path);
 
-  m_collector_group.register_collector<metrics::fsm::stateless_metrics_collector>(
-      "fsm::stateless",
-      m_metrics_path + "/" + p_output->metrics.stateless_fname,
-      p_output->metrics.collect_interval);
-  m_collector_group.register_collector<metrics::block_metrics_collector>(
+  m_stateless_collector =
+      collector_register<metrics::fsm::stateless_metrics_collector>(
+          "fsm::stateless",
+          m_metrics_path + "/" + p_output->metrics.stateless_fname,
+          p_output->metrics.collect_interval);
+  m_block_collector = collector_register<metrics::block_metrics_collector>(
       "block",
       m_metrics_path + "/" + p_output->metrics.block_fname,
       p_output->metrics.collect_interval);
 
-  m_collector_group.register_collector<metrics::fsm::distance_metrics_collector>(
-      "fsm::distance",
-      m_metrics_path + "/" + p_output->metrics.distance_fname,
-      p_output->metrics.collect_interval);
+  m_distance_collector =
+      collector_register<metrics::fsm::distance_metrics_collector>(
+          "fsm::distance",
+          m_metrics_path + "/" + p_output->metrics.distance_fname,
+          p_output->metrics.collect_interval);
 
   m_collector_group.reset_all();
 } /* metric_collecting_init() */
 
+void stateless_foraging_loop_functions::profiling_init(
+    const struct params::profiling_params* p_profiling) {
+  auto& profiler = metrics::tick_profiler::instance();
+  profiler.reset();
+  profiler.enabled(p_profiling->enabled);
+  if (p_profiling->enabled) {
+    m_profile_fname = m_metrics_path + "/" + p_profiling->summary_fname;
+    if (!p_profiling->histogram_fname.empty()) {
+      m_profile_hist_fname =
+          m_metrics_path + "/" + p_profiling->histogram_fname;
+    }
+    ER_NOM("Tick profiling enabled: output to %s", m_profile_fname.c_str());
+  }
+} /* profiling_init() */
+
 void stateless_foraging_loop_functions::arena_map_init(
     params::loop_function_repository& repo) {
   auto* arena_params = static_cast<const struct params::arena_map_params*>(
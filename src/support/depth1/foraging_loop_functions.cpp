@@ -35,6 +35,7 @@
 #include "fordyca/metrics/fsm/stateless_metrics_collector.hpp"
 #include "fordyca/metrics/tasks/execution_metrics_collector.hpp"
 #include "fordyca/metrics/tasks/management_metrics_collector.hpp"
+#include "fordyca/metrics/tick_profiler.hpp"
 #include "fordyca/params/loop_function_repository.hpp"
 #include "fordyca/params/loop_functions_params.hpp"
 #include "fordyca/params/output_params.hpp"
@@ -77,102 +78,87 @@ void foraging_loop_functions::Init(argos::TConfigurationNode& node) {
                                                  arenap->cache.usage_penalty);
 
   /* configure robots */
-  for (auto& entity_pair : GetSpace().GetEntitiesByType("foot-bot")) {
-    argos::CFootBotEntity& robot =
-        *argos::any_cast<argos::CFootBotEntity*>(entity_pair.second);
-    auto& controller = dynamic_cast<controller::depth1::foraging_controller&>(
-        robot.GetControllableEntity().GetController());
-    auto* l_params = static_cast<const struct params::loop_functions_params*>(
-        repo.get_params("loop_functions"));
-
-    controller.display_task(l_params->display_robot_task);
-  } /* for(&entity..) */
+  auto* l_params = static_cast<const struct params::loop_functions_params*>(
+      repo.get_params("loop_functions"));
+  m_robots.build(GetSpace());
+  for (auto& r : m_robots) {
+    r.controller->display_task(l_params->display_robot_task);
+  } /* for(&r..) */
   ER_NOM("depth1_foraging loop functions initialization finished");
 }
 
-void foraging_loop_functions::pre_step_iter(argos::CFootBotEntity& robot) {
-  auto& controller = dynamic_cast<controller::depth1::foraging_controller&>(
-      robot.GetControllableEntity().GetController());
-
-  /* get stats from this robot before its state changes */
-  collector_group().collect_from(
-      "fsm::distance", static_cast<metrics::fsm::distance_metrics&>(controller));
-  collector_group().collect_from(
-      "tasks::management",
+void foraging_loop_functions::pre_step_metrics(
+    const robot_registry<controller_type>::entry& r) {
+  auto& controller = *r.controller;
+  distance_collector().collect(
+      static_cast<metrics::fsm::distance_metrics&>(controller));
+  m_management_collector.collect(
       static_cast<rcppsw::metrics::tasks::management_metrics&>(controller));
 
   if (nullptr != controller.current_task()) {
-    collector_group().collect_from("fsm::stateless",
-                                   static_cast<metrics::fsm::stateless_metrics&>(
-                                       *controller.current_task()));
-    collector_group().collect_from("fsm::stateful",
-                                   static_cast<metrics::fsm::stateful_metrics&>(
-                                       *controller.current_task()));
-    collector_group().collect_from("fsm::depth1",
-                                   static_cast<metrics::fsm::depth1_metrics&>(
-                                       *controller.current_task()));
-    collector_group().collect_from(
-        "tasks::execution",
+    stateless_collector().collect(static_cast<metrics::fsm::stateless_metrics&>(
+        *controller.current_task()));
+    stateful_collector().collect(static_cast<metrics::fsm::stateful_metrics&>(
+        *controller.current_task()));
+    m_depth1_collector.collect(static_cast<metrics::fsm::depth1_metrics&>(
+        *controller.current_task()));
+    m_execution_collector.collect(
         static_cast<rcppsw::metrics::tasks::execution_metrics&>(
             *controller.current_task()));
   }
+} /* pre_step_metrics() */
 
+void foraging_loop_functions::pre_step_sense(
+    const robot_registry<controller_type>::entry& r) {
   /* send the robot its view of the world: what it sees and where it is */
-  utils::set_robot_pos<decltype(controller)>(robot);
-  set_robot_los<decltype(controller)>(robot, *arena_map());
-  set_robot_tick<decltype(controller)>(robot);
-
-  /* Now watch it react to the environment */
-  (*m_interactor)(controller,
+  utils::set_robot_pos(*r.robot, *r.controller);
+  set_robot_los(*r.robot, *r.controller, *arena_map());
+  set_robot_tick(*r.controller);
+} /* pre_step_sense() */
+
+void foraging_loop_functions::pre_step_iter(
+    const robot_registry<controller_type>::entry& r) {
+  metrics::phase_timer timer(metrics::tick_phase::kARENA_INTERACT);
+  (*m_interactor)(*r.controller,
                   GetSpace().GetSimulationClock(),
-                  static_cast<metrics::block_metrics_collector&>(
-                      *collector_group()["block"]));
+                  *block_collector());
 } /* pre_step_iter() */
 
-argos::CColor foraging_loop_functions::GetFloorColor(
-    const argos::CVector2& plane_pos) {
-  /* The nest is a light gray */
-  if (nest_xrange().WithinMinBoundIncludedMaxBoundIncluded(plane_pos.GetX()) &&
-      nest_yrange().WithinMinBoundIncludedMaxBoundIncluded(plane_pos.GetY())) {
-    return argos::CColor::GRAY70;
-  }
-
-  /*
-   * Blocks are inside caches, so display the cache the point is inside FIRST,
-   * so that you don't have blocks renderin inside of caches.
-   */
-  for (auto& cache : arena_map()->caches()) {
-    if (cache->contains_point(plane_pos)) {
-      return cache->color();
-    }
-  } /* for(&cache..) */
-
-  for (auto& block : arena_map()->blocks()) {
-    if (block->contains_point(plane_pos)) {
-      return block->color();
-    }
-  } /* for(&block..) */
-
-  return argos::CColor::WHITE;
-} /* GetFloorColor() */
-
+/*
+ * Same two phases as \ref stateless_foraging_loop_functions::PreStep(). All
+ * LOS are built before any robot interacts with the arena, so a cache that is
+ * depleted during the second phase may still be in the LOS of robots until the
+ * next timestep (previously this was true only for robots earlier in the
+ * iteration order); robots already handle caches vanishing out from under
+ * them.
+ */
 void foraging_loop_functions::PreStep() {
   /* Get metrics from caches */
   for (auto& c : arena_map()->caches()) {
-    collector_group().collect_from("cache",
-                                   static_cast<metrics::cache_metrics&>(*c));
+    m_cache_collector.collect(static_cast<metrics::cache_metrics&>(*c));
     c->reset_metrics();
   } /* for(&c..) */
 
-  for (auto& entity_pair : GetSpace().GetEntitiesByType("foot-bot")) {
-    argos::CFootBotEntity& robot =
-        *argos::any_cast<argos::CFootBotEntity*>(entity_pair.second);
-    pre_step_iter(robot);
-  } /* for(&entity..) */
+  for (auto& r : m_robots) {
+    pre_step_metrics(r);
+    utils::robot_los_allocate(*r.robot, *arena_map());
+  } /* for(&r..) */
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (size_t i = 0; i < m_robots.size(); ++i) {
+    pre_step_sense(m_robots[i]);
+  } /* for(i..) */
+
+  for (auto& r : m_robots) {
+    pre_step_iter(r);
+  } /* for(&r..) */
   pre_step_final();
 } /* PreStep() */
 
 void foraging_loop_functions::Reset() {
+  m_robots.build(GetSpace());
   collector_group().reset_all();
   arena_map()->static_cache_create();
 }
@@ -187,10 +173,8 @@ void foraging_loop_functions::pre_step_final(void) {
    * that the cache could be recreated (trying to emulate depth2 behavior here).
    */
   if (arena_map()->has_static_cache() && arena_map()->caches().empty()) {
-    auto& collector = static_cast<metrics::tasks::execution_metrics_collector&>(
-        *collector_group()["tasks::execution"]);
-    int n_harvesters = collector.n_harvesters();
-    int n_collectors = collector.n_collectors();
+    int n_harvesters = m_execution_collector->n_harvesters();
+    int n_collectors = m_execution_collector->n_collectors();
     math::cache_respawn_probability p(mc_cache_respawn_scale_factor);
     if (p.calc(n_harvesters, n_collectors) >=
         static_cast<double>(random()) / RAND_MAX) {
@@ -210,7 +194,10 @@ void foraging_loop_functions::pre_step_final(void) {
     arena_map()->cache_removed(false);
   }
 
-  collector_group().metrics_write_all(GetSpace().GetSimulationClock());
+  {
+    metrics::phase_timer timer(metrics::tick_phase::kMETRICS_WRITE);
+    collector_group().metrics_write_all(GetSpace().GetSimulationClock());
+  }
   collector_group().timestep_reset_all();
   collector_group().interval_reset_all();
   collector_group().timestep_inc_all();
@@ -231,24 +218,25 @@ void foraging_loop_functions::cache_handling_init(
 
 void foraging_loop_functions::metric_collecting_init(
     const struct params::output_params* output_p) {
-  collector_group().register_collector<metrics::fsm::depth1_metrics_collector>(
-      "fsm::depth1",
-      metrics_path() + "/" + output_p->metrics.depth1_fname,
-      output_p->metrics.collect_interval);
+  m_depth1_collector =
+      collector_register<metrics::fsm::depth1_metrics_collector>(
+          "fsm::depth1",
+          metrics_path() + "/" + output_p->metrics.depth1_fname,
+          output_p->metrics.collect_interval);
 
-  collector_group()
-      .register_collector<metrics::tasks::execution_metrics_collector>(
+  m_execution_collector =
+      collector_register<metrics::tasks::execution_metrics_collector>(
           "tasks::execution",
           metrics_path() + "/" + output_p->metrics.task_execution_fname,
           output_p->metrics.collect_interval);
 
-  collector_group()
-      .register_collector<metrics::tasks::management_metrics_collector>(
+  m_management_collector =
+      collector_register<metrics::tasks::management_metrics_collector>(
           "tasks::management",
           metrics_path() + "/" + output_p->metrics.task_management_fname,
           output_p->metrics.collect_interval);
 
-  collector_group().register_collector<metrics::cache_metrics_collector>(
+  m_cache_collector = collector_register<metrics::cache_metrics_collector>(
       "cache",
       metrics_path() + "/" + output_p->metrics.cache_fname,
       output_p->metrics.collect_interval);
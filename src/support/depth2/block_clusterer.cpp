@@ -0,0 +1,169 @@
+/**
+ * @file block_clusterer.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/support/depth2/block_clusterer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "fordyca/representation/block.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, support, depth2);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+std::vector<block_clusterer::block_list> block_clusterer::clusters(
+    const block_vector& blocks,
+    size_t min_size) {
+  size_t n_blocks = blocks.size();
+  m_parent.resize(n_blocks);
+  std::iota(m_parent.begin(), m_parent.end(), 0);
+  m_rank.assign(n_blocks, 0);
+
+  m_buckets.clear();
+  for (size_t i = 0; i < n_blocks; ++i) {
+    m_buckets.emplace_back(bucket(blocks[i]), i);
+  } /* for(i..) */
+  std::sort(m_buckets.begin(), m_buckets.end());
+
+  auto key_less = [](const bucket_entry& e, const bucket_key& k) {
+    return e.first < k;
+  };
+
+  /*
+   * Blocks can only be within the minimum distance of each other if they are
+   * in the same or adjacent grid cells. Each pair of adjacent cells is only
+   * visited once, by only looking "forward" from each cell.
+   */
+  const bucket_key kNeighbors[] = {{0, 1}, {1, -1}, {1, 0}, {1, 1}};
+  size_t begin = 0;
+  while (begin < m_buckets.size()) {
+    const bucket_key& key = m_buckets[begin].first;
+    size_t end = begin;
+    while (end < m_buckets.size() && m_buckets[end].first == key) {
+      ++end;
+    }
+    buckets_link(blocks, begin, end, begin, end);
+
+    for (auto& offset : kNeighbors) {
+      bucket_key nkey(key.first + offset.first, key.second + offset.second);
+      auto nbegin = std::lower_bound(m_buckets.begin() + end,
+                                     m_buckets.end(),
+                                     nkey,
+                                     key_less);
+      auto nend = nbegin;
+      while (nend != m_buckets.end() && nend->first == nkey) {
+        ++nend;
+      }
+      buckets_link(blocks,
+                   begin,
+                   end,
+                   static_cast<size_t>(nbegin - m_buckets.begin()),
+                   static_cast<size_t>(nend - m_buckets.begin()));
+    } /* for(&offset..) */
+    begin = end;
+  } /* while(begin..) */
+
+  /*
+   * Gather the clusters in input order, so that the output does not depend on
+   * how the grid cells were sorted.
+   */
+  std::vector<size_t> sizes(n_blocks, 0);
+  for (size_t i = 0; i < n_blocks; ++i) {
+    ++sizes[find(i)];
+  } /* for(i..) */
+
+  std::vector<block_list> clusters;
+  std::vector<size_t> slots(n_blocks, n_blocks);
+  for (size_t i = 0; i < n_blocks; ++i) {
+    size_t root = find(i);
+    if (sizes[root] < min_size) {
+      continue;
+    }
+    if (n_blocks == slots[root]) {
+      slots[root] = clusters.size();
+      clusters.emplace_back();
+    }
+    clusters[slots[root]].push_back(blocks[i]);
+  } /* for(i..) */
+  return clusters;
+} /* clusters() */
+
+block_clusterer::bucket_key block_clusterer::bucket(
+    const std::shared_ptr<representation::block>& block) const {
+  /*
+   * Any cell size >= the minimum distance is correct; it only has to be
+   * non-zero.
+   */
+  double size = (m_min_dist > 0.0) ? m_min_dist : 1.0;
+  return {static_cast<long>(std::floor(block->real_loc().GetX() / size)),
+          static_cast<long>(std::floor(block->real_loc().GetY() / size))};
+} /* bucket() */
+
+void block_clusterer::buckets_link(const block_vector& blocks,
+                                   size_t begin1, size_t end1,
+                                   size_t begin2, size_t end2) {
+  for (size_t a = begin1; a < end1; ++a) {
+    size_t i = m_buckets[a].second;
+    /* within a single cell, only look at each pair once */
+    for (size_t b = (begin1 == begin2) ? a + 1 : begin2; b < end2; ++b) {
+      size_t j = m_buckets[b].second;
+      if (find(i) == find(j)) {
+        continue;
+      }
+      if ((blocks[i]->real_loc() - blocks[j]->real_loc()).Length() <=
+          m_min_dist) {
+        join(i, j);
+      }
+    } /* for(b..) */
+  }   /* for(a..) */
+} /* buckets_link() */
+
+size_t block_clusterer::find(size_t i) {
+  while (m_parent[i] != i) {
+    m_parent[i] = m_parent[m_parent[i]];
+    i = m_parent[i];
+  } /* while(..) */
+  return i;
+} /* find() */
+
+void block_clusterer::join(size_t i, size_t j) {
+  size_t root_i = find(i);
+  size_t root_j = find(j);
+  if (root_i == root_j) {
+    return;
+  }
+  if (m_rank[root_i] < m_rank[root_j]) {
+    std::swap(root_i, root_j);
+  }
+  m_parent[root_j] = root_i;
+  if (m_rank[root_i] == m_rank[root_j]) {
+    ++m_rank[root_i];
+  }
+} /* join() */
+
+NS_END(depth2, support, fordyca);
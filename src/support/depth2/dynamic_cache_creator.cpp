@@ -42,7 +42,7 @@ dynamic_cache_creator::dynamic_cache_creator(
     double resolution,
     double min_dist)
     : cache_creator(server, grid, cache_size, resolution),
-      m_min_dist(min_dist) {}
+      m_clusterer(min_dist) {}
 
 /*******************************************************************************
  * Member Functions
@@ -53,33 +53,22 @@ depth1::cache_creator::cache_vector dynamic_cache_creator::create_all(
 
   ER_NOM("Dynamically creating caches: %zu free blocks", blocks.size());
 
-  for (size_t i = 0; i < blocks.size() - 1; ++i) {
-    block_list starter_blocks;
-    for (size_t j = i + 1; j < blocks.size(); ++j) {
-      if ((blocks[i]->real_loc() - blocks[j]->real_loc()).Length() <=
-          m_min_dist) {
-        if (std::find(starter_blocks.begin(), starter_blocks.end(), blocks[i]) ==
-            starter_blocks.end()) {
-          ER_DIAG("Add block %zu: (%f, %f)",
-                  i,
-                  blocks[i]->real_loc().GetX(),
-                  blocks[i]->real_loc().GetY());
-          starter_blocks.push_back(blocks[i]);
-        }
-        starter_blocks.push_back(blocks[j]);
-        ER_DIAG("Add block %zu: (%f, %f)",
-                j,
-                blocks[j]->real_loc().GetX(),
-                blocks[j]->real_loc().GetY());
-      }
-    } /* for(j..) */
-    if (starter_blocks.size()) {
-      argos::CVector2 center = calc_center(starter_blocks);
-      caches.push_back(cache_creator::create_single(starter_blocks, center));
-    }
-  } /* for(i..) */
+  /*
+   * Clusters are disjoint, so no block can end up in more than one cache. A
+   * cache needs at least 2 blocks.
+   */
+  for (auto& cluster : m_clusterer.clusters(blocks, 2)) {
+    for (auto& b : cluster) {
+      ER_DIAG("Add block%d: (%f, %f)",
+              b->id(),
+              b->real_loc().GetX(),
+              b->real_loc().GetY());
+    } /* for(&b..) */
+    argos::CVector2 center = calc_center(cluster);
+    caches.push_back(cache_creator::create_single(cluster, center));
+  } /* for(&cluster..) */
   return caches;
-} /* create() */
+} /* create_all() */
 
 argos::CVector2 dynamic_cache_creator::calc_center(const block_list& blocks) {
   double x = 0;
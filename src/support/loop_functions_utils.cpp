@@ -23,6 +23,7 @@
  ******************************************************************************/
 #include "fordyca/support/loop_functions_utils.hpp"
 #include "fordyca/controller/base_foraging_controller.hpp"
+#include "fordyca/math/utils.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -50,8 +51,7 @@ int robot_id(argos::CFootBotEntity& robot) {
 } /* robot_id() */
 
 int robot_id(const controller::base_foraging_controller& controller) {
-  /* +2 because the ID string starts with 'fb' */
-  return std::atoi(controller.GetId().c_str() + 2);
+  return controller.entity_id();
 } /* robot_id() */
 
 int robot_on_cache(const controller::base_foraging_controller& controller,
@@ -66,6 +66,23 @@ __pure int robot_on_cache(argos::CFootBotEntity& robot,
                         map);
 }
 
+rcppsw::math::dcoord2 robot_dloc(const argos::CFootBotEntity& robot,
+                                 const representation::arena_map& map) {
+  const argos::CVector3& pos3 =
+      const_cast<argos::CFootBotEntity&>(robot)
+          .GetEmbodiedEntity()
+          .GetOriginAnchor()
+          .Position;
+  return math::rcoord_to_dcoord(argos::CVector2(pos3.GetX(), pos3.GetY()),
+                                map.grid_resolution());
+} /* robot_dloc() */
+
+void robot_los_allocate(const argos::CFootBotEntity& robot,
+                        representation::arena_map& map) {
+  rcppsw::math::dcoord2 robot_loc = robot_dloc(robot, map);
+  map.subgrid_allocate(robot_loc.first, robot_loc.second, kROBOT_LOS_RADIUS);
+} /* robot_los_allocate() */
+
 __const bool block_drop_overlap_with_cache(
     const std::shared_ptr<representation::block>& block,
     const std::shared_ptr<representation::arena_cache>& cache,
@@ -0,0 +1,152 @@
+/**
+ * @file block_clusterer-test.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_PREFIX_ALL
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "fordyca/representation/block.hpp"
+#include "fordyca/support/depth2/block_clusterer.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca::representation;
+using fordyca::support::depth2::block_clusterer;
+using block_vector = block_clusterer::block_vector;
+using block_list = block_clusterer::block_list;
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+const double kMIN_DIST = 1.0;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+std::shared_ptr<block> block_make(int id, double x, double y) {
+  auto b = std::make_shared<block>(0.2, id);
+  b->real_loc(argos::CVector2(x, y));
+  return b;
+}
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+CATCH_TEST_CASE("pair-test", "[block_clusterer]") {
+  block_clusterer clusterer(kMIN_DIST);
+
+  /* within the minimum distance, but on either side of a bucket boundary */
+  block_vector blocks = {block_make(0, 0.9, 0.5), block_make(1, 1.1, 0.5)};
+  auto clusters = clusterer.clusters(blocks, 2);
+  CATCH_REQUIRE(1 == clusters.size());
+  CATCH_REQUIRE(2 == clusters.front().size());
+
+  /* in adjacent buckets, but too far apart */
+  blocks = {block_make(0, 0.05, 0.5), block_make(1, 1.1, 0.5)};
+  CATCH_REQUIRE(clusterer.clusters(blocks, 2).empty());
+
+  /* diagonal neighbors, in both directions */
+  blocks = {block_make(0, 0.9, 0.9), block_make(1, 1.1, 1.1)};
+  CATCH_REQUIRE(1 == clusterer.clusters(blocks, 2).size());
+  blocks = {block_make(0, 0.9, 1.1), block_make(1, 1.1, 0.9)};
+  CATCH_REQUIRE(1 == clusterer.clusters(blocks, 2).size());
+}
+
+CATCH_TEST_CASE("chain-test", "[block_clusterer]") {
+  block_clusterer clusterer(kMIN_DIST);
+
+  /*
+   * Only consecutive blocks in the chain are within the minimum distance, and
+   * the chain crosses several bucket boundaries in both dimensions. The blocks
+   * are not in chain order, so parts of the chain are found separately and
+   * then merged.
+   */
+  block_vector blocks;
+  for (int i = 0; i < 6; ++i) {
+    blocks.push_back(block_make(i, 0.5 + 0.85 * i, 0.5 + 0.4 * i));
+  } /* for(i..) */
+  blocks.push_back(block_make(6, 20.0, 20.0));
+  std::swap(blocks[2], blocks[5]);
+
+  auto clusters = clusterer.clusters(blocks, 2);
+  CATCH_REQUIRE(1 == clusters.size());
+  CATCH_REQUIRE(6 == clusters.front().size());
+
+  /* blocks within a cluster are in input order */
+  block_list expected(blocks.begin(), blocks.begin() + 6);
+  CATCH_REQUIRE(expected == clusters.front());
+
+  /* singletons are only returned if asked for */
+  CATCH_REQUIRE(2 == clusterer.clusters(blocks, 1).size());
+}
+
+CATCH_TEST_CASE("boundary-test", "[block_clusterer]") {
+  block_clusterer clusterer(kMIN_DIST);
+
+  /* nothing to cluster */
+  CATCH_REQUIRE(clusterer.clusters(block_vector(), 1).empty());
+
+  /* exactly the minimum distance apart is linked */
+  block_vector blocks = {block_make(0, 0.0, 0.0), block_make(1, 1.0, 0.0)};
+  CATCH_REQUIRE(1 == clusterer.clusters(blocks, 2).size());
+
+  /* either side of the origin, where bucket indices go negative */
+  blocks = {block_make(0, -0.1, -0.1), block_make(1, 0.1, 0.1)};
+  CATCH_REQUIRE(1 == clusterer.clusters(blocks, 2).size());
+
+  /* blocks on top of each other */
+  blocks = {block_make(0, 3.0, 3.0), block_make(1, 3.0, 3.0)};
+  CATCH_REQUIRE(1 == clusterer.clusters(blocks, 2).size());
+
+  /* a zero minimum distance only links coincident blocks */
+  block_clusterer zero(0.0);
+  blocks.push_back(block_make(2, 3.0, 3.5));
+  auto clusters = zero.clusters(blocks, 1);
+  CATCH_REQUIRE(2 == clusters.size());
+  CATCH_REQUIRE(2 == clusters.front().size());
+}
+
+CATCH_TEST_CASE("min-size-test", "[block_clusterer]") {
+  block_clusterer clusterer(kMIN_DIST);
+
+  /* a cluster of exactly the minimum size is kept, one smaller is not */
+  block_vector blocks = {block_make(0, 0.5, 0.5),
+                         block_make(1, 1.0, 0.5),
+                         block_make(2, 1.5, 0.5),
+                         block_make(3, 10.5, 0.5),
+                         block_make(4, 11.0, 0.5)};
+  auto clusters = clusterer.clusters(blocks, 3);
+  CATCH_REQUIRE(1 == clusters.size());
+  CATCH_REQUIRE(3 == clusters.front().size());
+  CATCH_REQUIRE(blocks[0] == clusters.front().front());
+  CATCH_REQUIRE(clusterer.clusters(blocks, 4).empty());
+
+  /*
+   * Running again with fewer blocks does not see anything left over from the
+   * last run.
+   */
+  blocks.resize(2);
+  clusters = clusterer.clusters(blocks, 2);
+  CATCH_REQUIRE(1 == clusters.size());
+  CATCH_REQUIRE(2 == clusters.front().size());
+}
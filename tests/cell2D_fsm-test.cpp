@@ -0,0 +1,134 @@
+/**
+ * @file cell2D_fsm-test.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_PREFIX_ALL
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "fordyca/fsm/cell2D_fsm.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using fordyca::fsm::cell2D_fsm;
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+CATCH_TEST_CASE("init-test", "[cell2D_fsm]") {
+  cell2D_fsm fsm;
+  CATCH_REQUIRE(!fsm.state_is_known());
+  CATCH_REQUIRE(0 == fsm.block_count());
+}
+
+CATCH_TEST_CASE("cache-test", "[cell2D_fsm]") {
+  cell2D_fsm fsm;
+  fsm.event_empty();
+  CATCH_REQUIRE(fsm.state_is_empty());
+
+  fsm.event_block_drop();
+  CATCH_REQUIRE(fsm.state_has_block());
+  CATCH_REQUIRE(1 == fsm.block_count());
+
+  fsm.event_block_drop();
+  fsm.event_block_drop();
+  CATCH_REQUIRE(fsm.state_has_cache());
+  CATCH_REQUIRE(3 == fsm.block_count());
+
+  /* a cache with one block left is just a block */
+  fsm.event_block_pickup();
+  CATCH_REQUIRE(fsm.state_has_cache());
+  fsm.event_block_pickup();
+  CATCH_REQUIRE(fsm.state_has_block());
+  CATCH_REQUIRE(1 == fsm.block_count());
+  fsm.event_block_pickup();
+  CATCH_REQUIRE(fsm.state_is_empty());
+  CATCH_REQUIRE(0 == fsm.block_count());
+
+  /* forgetting a cache forgets its blocks */
+  fsm.event_block_drop();
+  fsm.event_block_drop();
+  fsm.event_unknown();
+  CATCH_REQUIRE(!fsm.state_is_known());
+  CATCH_REQUIRE(0 == fsm.block_count());
+}
+
+CATCH_TEST_CASE("transition-test", "[cell2D_fsm]") {
+  cell2D_fsm fsm;
+
+  /* a block dropped into an unknown cell is known to be there */
+  fsm.event_block_drop();
+  CATCH_REQUIRE(fsm.state_has_block());
+  CATCH_REQUIRE(1 == fsm.block_count());
+
+  /* seeing a cache as empty forgets its blocks */
+  fsm.event_block_drop();
+  fsm.event_empty();
+  CATCH_REQUIRE(fsm.state_is_empty());
+  CATCH_REQUIRE(0 == fsm.block_count());
+
+  /* repeated events leave the cell as it was */
+  fsm.event_empty();
+  CATCH_REQUIRE(fsm.state_is_empty());
+  fsm.event_unknown();
+  fsm.event_unknown();
+  CATCH_REQUIRE(!fsm.state_is_known());
+  CATCH_REQUIRE(0 == fsm.block_count());
+}
+
+CATCH_TEST_CASE("block-count-test", "[cell2D_fsm]") {
+  cell2D_fsm fsm;
+  fsm.event_block_count(0);
+  CATCH_REQUIRE(fsm.state_is_empty());
+  fsm.event_block_count(1);
+  CATCH_REQUIRE(fsm.state_has_block());
+  fsm.event_block_count(5);
+  CATCH_REQUIRE(fsm.state_has_cache());
+  CATCH_REQUIRE(5 == fsm.block_count());
+
+  /* the count carries on from where it was set */
+  fsm.event_block_drop();
+  CATCH_REQUIRE(6 == fsm.block_count());
+}
+
+CATCH_TEST_CASE("illegal-test", "[cell2D_fsm]") {
+  /* picking up a block from a cell without one leaves the cell as it was */
+  cell2D_fsm fsm;
+  CATCH_REQUIRE(!fsm.event_block_pickup());
+  CATCH_REQUIRE(!fsm.state_is_known());
+  fsm.event_empty();
+  CATCH_REQUIRE(!fsm.event_block_pickup());
+  CATCH_REQUIRE(fsm.state_is_empty());
+  CATCH_REQUIRE(0 == fsm.block_count());
+
+  /* the block count cannot wrap around */
+  CATCH_REQUIRE(!fsm.event_block_count(cell2D_fsm::kMAX_BLOCK_COUNT + 1));
+  CATCH_REQUIRE(fsm.state_is_empty());
+  CATCH_REQUIRE(fsm.event_block_count(cell2D_fsm::kMAX_BLOCK_COUNT));
+  CATCH_REQUIRE(!fsm.event_block_drop());
+  CATCH_REQUIRE(cell2D_fsm::kMAX_BLOCK_COUNT == fsm.block_count());
+
+  /* a full cache can still be picked up from */
+  CATCH_REQUIRE(fsm.event_block_pickup());
+  CATCH_REQUIRE(cell2D_fsm::kMAX_BLOCK_COUNT - 1 == fsm.block_count());
+  CATCH_REQUIRE(fsm.event_block_drop());
+}
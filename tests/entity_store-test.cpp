@@ -0,0 +1,185 @@
+/**
+ * @file entity_store-test.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_PREFIX_ALL
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include <algorithm>
+#include <list>
+#include "fordyca/representation/entity_store.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca::representation;
+using rcppsw::math::dcoord2;
+
+/*******************************************************************************
+ * Helper Classes/Functions
+ ******************************************************************************/
+/*
+ * The store only needs an ID and a discrete location, so a stand-in is used
+ * instead of real blocks/caches.
+ */
+struct entity {
+  entity(int id, const dcoord2& loc) : m_id(id), m_loc(loc) {}
+  int id(void) const { return m_id; }
+  const dcoord2& discrete_loc(void) const { return m_loc; }
+
+  int m_id;
+  dcoord2 m_loc;
+};
+using entity_list = std::list<std::shared_ptr<entity>>;
+
+/*
+ * The linear searches over a list that perceived_arena_map did before the
+ * store existed.
+ */
+std::shared_ptr<entity> list_find_by_id(const entity_list& l, int id) {
+  auto it = std::find_if(
+      l.begin(), l.end(), [&](const std::shared_ptr<entity>& e) {
+        return e->id() == id;
+      });
+  return (l.end() == it) ? nullptr : *it;
+}
+std::shared_ptr<entity> list_find_by_loc(const entity_list& l,
+                                         const dcoord2& loc) {
+  auto it = std::find_if(
+      l.begin(), l.end(), [&](const std::shared_ptr<entity>& e) {
+        return e->discrete_loc() == loc;
+      });
+  return (l.end() == it) ? nullptr : *it;
+}
+
+void check_matches(const entity_store<entity>& store, const entity_list& l) {
+  CATCH_REQUIRE(store.size() == l.size());
+  CATCH_REQUIRE(std::equal(l.begin(), l.end(), store.begin()));
+  for (auto& e : l) {
+    CATCH_REQUIRE(store.find_by_id(e->id()) == list_find_by_id(l, e->id()));
+    CATCH_REQUIRE(store.find_by_loc(e->discrete_loc()) ==
+                  list_find_by_loc(l, e->discrete_loc()));
+  } /* for(&e..) */
+}
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+CATCH_TEST_CASE("empty-test", "[entity_store]") {
+  entity_store<entity> store;
+  CATCH_REQUIRE(store.empty());
+  CATCH_REQUIRE(nullptr == store.find_by_id(0));
+  CATCH_REQUIRE(nullptr == store.find_by_loc(dcoord2(0, 0)));
+  CATCH_REQUIRE(!store.remove_by_id(0));
+  CATCH_REQUIRE(!store.remove_by_loc(dcoord2(0, 0)));
+}
+
+CATCH_TEST_CASE("index-test", "[entity_store]") {
+  entity_store<entity> store;
+  auto e1 = std::make_shared<entity>(1, dcoord2(3, 4));
+  auto e2 = std::make_shared<entity>(2, dcoord2(4, 3));
+  store.add(e1);
+  store.add(e2);
+
+  CATCH_REQUIRE(store.find_by_id(1) == e1);
+  CATCH_REQUIRE(store.find_by_id(2) == e2);
+  CATCH_REQUIRE(store.find_by_loc(dcoord2(3, 4)) == e1);
+  CATCH_REQUIRE(store.find_by_loc(dcoord2(4, 3)) == e2);
+  CATCH_REQUIRE(nullptr == store.find_by_id(3));
+  CATCH_REQUIRE(nullptr == store.find_by_loc(dcoord2(3, 3)));
+}
+
+CATCH_TEST_CASE("remove-test", "[entity_store]") {
+  entity_store<entity> store;
+  auto e1 = std::make_shared<entity>(1, dcoord2(1, 1));
+  auto e2 = std::make_shared<entity>(2, dcoord2(2, 2));
+  auto e3 = std::make_shared<entity>(3, dcoord2(3, 3));
+  store.add(e1);
+  store.add(e2);
+  store.add(e3);
+
+  /* removing from the middle keeps the rest in insertion order */
+  CATCH_REQUIRE(store.remove_by_id(2));
+  CATCH_REQUIRE(nullptr == store.find_by_id(2));
+  CATCH_REQUIRE(nullptr == store.find_by_loc(dcoord2(2, 2)));
+  check_matches(store, {e1, e3});
+
+  CATCH_REQUIRE(store.remove_by_loc(dcoord2(1, 1)));
+  CATCH_REQUIRE(!store.remove_by_loc(dcoord2(1, 1)));
+  check_matches(store, {e3});
+
+  store.clear();
+  CATCH_REQUIRE(store.empty());
+  CATCH_REQUIRE(nullptr == store.find_by_id(3));
+}
+
+CATCH_TEST_CASE("stale-test", "[entity_store]") {
+  entity_store<entity> store;
+  auto old_e = std::make_shared<entity>(1, dcoord2(1, 1));
+  auto new_e = std::make_shared<entity>(1, dcoord2(2, 2));
+  store.add(old_e);
+  store.add(new_e);
+
+  /* the index refers to the most recent entity with an ID */
+  CATCH_REQUIRE(store.find_by_id(1) == new_e);
+  CATCH_REQUIRE(store.find_by_loc(dcoord2(1, 1)) == old_e);
+
+  /*
+   * Removing the stale entity by location must not drop the index entry of
+   * the new one.
+   */
+  CATCH_REQUIRE(store.remove_by_loc(dcoord2(1, 1)));
+  CATCH_REQUIRE(store.find_by_id(1) == new_e);
+  check_matches(store, {new_e});
+}
+
+CATCH_TEST_CASE("shared-loc-test", "[entity_store]") {
+  entity_store<entity> store;
+  auto e1 = std::make_shared<entity>(1, dcoord2(5, 5));
+  auto e2 = std::make_shared<entity>(2, dcoord2(5, 5));
+  store.add(e1);
+  store.add(e2);
+
+  /* the location index refers to the most recent entity at a location */
+  CATCH_REQUIRE(store.find_by_loc(dcoord2(5, 5)) == e2);
+
+  /*
+   * Removing the older entity by ID must not drop the location index entry of
+   * the newer one.
+   */
+  CATCH_REQUIRE(store.remove_by_id(1));
+  CATCH_REQUIRE(store.find_by_loc(dcoord2(5, 5)) == e2);
+  check_matches(store, {e2});
+}
+
+CATCH_TEST_CASE("clear-test", "[entity_store]") {
+  entity_store<entity> store;
+  store.clear();
+  CATCH_REQUIRE(store.empty());
+
+  /* the store is usable again after being cleared */
+  auto e1 = std::make_shared<entity>(1, dcoord2(1, 1));
+  store.add(e1);
+  store.clear();
+  store.add(e1);
+  check_matches(store, {e1});
+}
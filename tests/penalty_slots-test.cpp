@@ -0,0 +1,129 @@
+/**
+ * @file penalty_slots-test.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_PREFIX_ALL
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include "fordyca/support/depth1/penalty_slots.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca::support::depth1;
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+CATCH_TEST_CASE("alloc-test", "[penalty_slots]") {
+  penalty_slots slots;
+  CATCH_REQUIRE(slots.empty());
+
+  /* robots arriving on the same timestep finish on consecutive ones */
+  CATCH_REQUIRE(10 == slots.alloc(10));
+  CATCH_REQUIRE(11 == slots.alloc(10));
+  CATCH_REQUIRE(12 == slots.alloc(10));
+
+  /* a free timestep is used as is, and later ones skip over it */
+  CATCH_REQUIRE(14 == slots.alloc(14));
+  CATCH_REQUIRE(13 == slots.alloc(11));
+  CATCH_REQUIRE(15 == slots.alloc(10));
+  CATCH_REQUIRE(5 == slots.alloc(5));
+
+  for (uint i = 10; i <= 15; ++i) {
+    CATCH_REQUIRE(slots.in_use(i));
+  } /* for(i..) */
+  CATCH_REQUIRE(slots.in_use(5));
+  CATCH_REQUIRE(!slots.in_use(4));
+  CATCH_REQUIRE(!slots.in_use(6));
+  CATCH_REQUIRE(!slots.in_use(16));
+}
+
+CATCH_TEST_CASE("free-test", "[penalty_slots]") {
+  penalty_slots slots;
+  for (uint i = 0; i < 5; ++i) {
+    slots.alloc(20);
+  } /* for(i..) */
+
+  /* freeing from the middle of an interval splits it */
+  slots.free(22);
+  CATCH_REQUIRE(!slots.in_use(22));
+  CATCH_REQUIRE(slots.in_use(21));
+  CATCH_REQUIRE(slots.in_use(23));
+  CATCH_REQUIRE(22 == slots.alloc(20));
+
+  /* freeing an unused timestep does nothing */
+  slots.free(30);
+  slots.free(19);
+  CATCH_REQUIRE(25 == slots.alloc(20));
+
+  for (uint i = 20; i <= 25; ++i) {
+    slots.free(i);
+  } /* for(i..) */
+  CATCH_REQUIRE(slots.empty());
+}
+
+CATCH_TEST_CASE("exhaust-test", "[penalty_slots]") {
+  penalty_slots slots;
+
+  /*
+   * Filling the gap between two runs of taken timesteps merges them, so the
+   * next robot to request any timestep in either run is pushed past both.
+   */
+  for (uint i = 0; i < 3; ++i) {
+    slots.alloc(10);
+    slots.alloc(14);
+  } /* for(i..) */
+  CATCH_REQUIRE(13 == slots.alloc(10));
+  CATCH_REQUIRE(17 == slots.alloc(10));
+  CATCH_REQUIRE(18 == slots.alloc(16));
+  for (uint i = 10; i <= 18; ++i) {
+    CATCH_REQUIRE(slots.in_use(i));
+  } /* for(i..) */
+
+  /* a single freed timestep in the middle of the run is reused first */
+  slots.free(15);
+  CATCH_REQUIRE(15 == slots.alloc(10));
+  CATCH_REQUIRE(19 == slots.alloc(10));
+}
+
+CATCH_TEST_CASE("boundary-test", "[penalty_slots]") {
+  penalty_slots slots;
+
+  /* timestep 0 has no predecessor to merge with */
+  CATCH_REQUIRE(0 == slots.alloc(0));
+  CATCH_REQUIRE(1 == slots.alloc(0));
+  slots.free(0);
+  CATCH_REQUIRE(!slots.in_use(0));
+  CATCH_REQUIRE(slots.in_use(1));
+  CATCH_REQUIRE(0 == slots.alloc(0));
+
+  /* freeing both ends of an interval leaves only its middle */
+  CATCH_REQUIRE(2 == slots.alloc(0));
+  slots.free(0);
+  slots.free(2);
+  CATCH_REQUIRE(!slots.in_use(0));
+  CATCH_REQUIRE(slots.in_use(1));
+  CATCH_REQUIRE(!slots.in_use(2));
+  slots.free(1);
+  CATCH_REQUIRE(slots.empty());
+}
@@ -0,0 +1,262 @@
+/**
+ * @file tiled_grid-test.cpp
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_PREFIX_ALL
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include <vector>
+#include "fordyca/representation/tiled_grid.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca::representation;
+using grid_type = tiled_grid<int>;
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/* Not a multiple of the tile size, so the upper edge tiles are padded */
+const size_t kXDIM = 70;
+const size_t kYDIM = 45;
+const size_t kTILE_DIM = grid_type::kTILE_DIM;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+int elt_value(size_t i, size_t j) { return static_cast<int>(i * 1000 + j); }
+
+void elt_init(size_t i, size_t j, int& elt) { elt = elt_value(i, j); }
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+CATCH_TEST_CASE("lazy-test", "[tiled_grid]") {
+  grid_type grid(kXDIM, kYDIM, elt_init);
+  const grid_type& cgrid = grid;
+  CATCH_REQUIRE(6 == grid.n_tiles());
+  CATCH_REQUIRE(0 == grid.n_allocated_tiles());
+
+  /* reading never allocates, and reads the blank element */
+  CATCH_REQUIRE(elt_value(0, 0) == cgrid.access(40, 40));
+  CATCH_REQUIRE(!grid.allocated(40, 40));
+  CATCH_REQUIRE(0 == grid.n_allocated_tiles());
+
+  /* writing allocates and initializes only the tile written to */
+  grid.access(40, 40) = -1;
+  CATCH_REQUIRE(1 == grid.n_allocated_tiles());
+  CATCH_REQUIRE(grid.allocated(kTILE_DIM, kTILE_DIM));
+  CATCH_REQUIRE(grid.allocated(2 * kTILE_DIM - 1, kYDIM - 1));
+  CATCH_REQUIRE(!grid.allocated(kTILE_DIM - 1, kTILE_DIM));
+  CATCH_REQUIRE(-1 == cgrid.access(40, 40));
+  CATCH_REQUIRE(elt_value(41, 40) == cgrid.access(41, 40));
+
+  /* allocating a range covers every tile it touches, and nothing else */
+  grid.allocate(kTILE_DIM - 1, 0, kTILE_DIM + 1, 1);
+  CATCH_REQUIRE(3 == grid.n_allocated_tiles());
+  CATCH_REQUIRE(grid.allocated(0, 0));
+  CATCH_REQUIRE(grid.allocated(kTILE_DIM, 0));
+  grid.allocate(10, 10, 10, 20);
+  CATCH_REQUIRE(3 == grid.n_allocated_tiles());
+
+  /* allocating never overwrites */
+  grid.allocate_all();
+  CATCH_REQUIRE(6 == grid.n_allocated_tiles());
+  CATCH_REQUIRE(-1 == cgrid.access(40, 40));
+}
+
+CATCH_TEST_CASE("cow-test", "[tiled_grid]") {
+  grid_type baseline(kXDIM, kYDIM, elt_init);
+  baseline.allocate_all();
+  CATCH_REQUIRE(6 == baseline.n_owned_tiles());
+
+  grid_type copy(baseline);
+  CATCH_REQUIRE(0 == baseline.n_owned_tiles());
+  CATCH_REQUIRE(0 == copy.n_owned_tiles());
+
+  /* writing to a shared tile copies it, leaving the original as it was */
+  copy.access(5, 5) = -1;
+  CATCH_REQUIRE(1 == copy.n_owned_tiles());
+  CATCH_REQUIRE(1 == baseline.n_owned_tiles());
+  CATCH_REQUIRE(elt_value(5, 5) == static_cast<const grid_type&>(baseline)
+                                       .access(5, 5));
+  CATCH_REQUIRE(-1 == static_cast<const grid_type&>(copy).access(5, 5));
+  CATCH_REQUIRE(elt_value(6, 5) == static_cast<const grid_type&>(copy)
+                                       .access(6, 5));
+
+  /* the owned copy is written to in place from then on */
+  copy.access(6, 5) = -2;
+  CATCH_REQUIRE(1 == copy.n_owned_tiles());
+  CATCH_REQUIRE(elt_value(6, 5) == static_cast<const grid_type&>(baseline)
+                                       .access(6, 5));
+
+  /* visiting for writing copies every shared tile */
+  copy.for_each_allocated([](size_t, size_t, int&) {});
+  CATCH_REQUIRE(6 == copy.n_owned_tiles());
+  CATCH_REQUIRE(6 == baseline.n_owned_tiles());
+}
+
+CATCH_TEST_CASE("shared-test", "[tiled_grid]") {
+  grid_type baseline(kXDIM, kYDIM);
+  baseline.allocate_all();
+  grid_type copy1(baseline);
+  grid_type copy2(baseline);
+
+  /*
+   * A tile shared three ways is still shared by the other two after one of
+   * them writes to it.
+   */
+  copy1.access(kXDIM - 1, kYDIM - 1) = -1;
+  CATCH_REQUIRE(1 == copy1.n_owned_tiles());
+  CATCH_REQUIRE(0 == copy2.n_owned_tiles());
+  CATCH_REQUIRE(0 == baseline.n_owned_tiles());
+  CATCH_REQUIRE(0 == static_cast<const grid_type&>(copy2).access(kXDIM - 1,
+                                                                 kYDIM - 1));
+
+  /* assigning a grid shares its tiles, as copying does */
+  copy2 = copy1;
+  CATCH_REQUIRE(0 == copy1.n_owned_tiles());
+  CATCH_REQUIRE(-1 == static_cast<const grid_type&>(copy2).access(kXDIM - 1,
+                                                                  kYDIM - 1));
+  copy2.access(kXDIM - 1, kYDIM - 1) = -2;
+  CATCH_REQUIRE(-1 == static_cast<const grid_type&>(copy1).access(kXDIM - 1,
+                                                                  kYDIM - 1));
+}
+
+CATCH_TEST_CASE("for-each-test", "[tiled_grid]") {
+  grid_type grid(kXDIM, kYDIM, elt_init);
+  grid.access(0, 0) = -1;
+  grid.access(kXDIM - 1, kYDIM - 1) = -1;
+
+  /*
+   * Only the elements of the two allocated tiles are visited, once each, and
+   * not the padding past the edges of the grid.
+   */
+  std::vector<std::vector<int>> visits(kXDIM, std::vector<int>(kYDIM, 0));
+  size_t n_visited = 0;
+  static_cast<const grid_type&>(grid).for_each_allocated(
+      [&](size_t i, size_t j, const int&) {
+        CATCH_REQUIRE(i < kXDIM);
+        CATCH_REQUIRE(j < kYDIM);
+        ++visits[i][j];
+        ++n_visited;
+      });
+  size_t edge = (kXDIM - 2 * kTILE_DIM) * (kYDIM - kTILE_DIM);
+  CATCH_REQUIRE(kTILE_DIM * kTILE_DIM + edge == n_visited);
+  for (size_t i = 0; i < kXDIM; ++i) {
+    for (size_t j = 0; j < kYDIM; ++j) {
+      CATCH_REQUIRE(visits[i][j] == (grid.allocated(i, j) ? 1 : 0));
+    } /* for(j..) */
+  }   /* for(i..) */
+
+  /* each element is passed with its own indices */
+  grid.for_each_allocated([](size_t i, size_t j, int& elt) {
+    if (-1 != elt) {
+      CATCH_REQUIRE(elt_value(i, j) == elt);
+    }
+    elt = 7;
+  });
+  CATCH_REQUIRE(7 == static_cast<const grid_type&>(grid).access(1, 1));
+}
+
+CATCH_TEST_CASE("blank-test", "[tiled_grid]") {
+  grid_type grid(kXDIM, kYDIM, [](size_t i, size_t j, int& elt) {
+    elt = elt_value(i, j) + 5;
+  });
+
+  /* unallocated elements read as a new tile's element (0, 0) would */
+  CATCH_REQUIRE(5 == static_cast<const grid_type&>(grid).access(40, 40));
+
+  /* the blank element is shared by copies, and never written to */
+  grid_type copy(grid);
+  copy.access(40, 40) = -1;
+  CATCH_REQUIRE(5 == static_cast<const grid_type&>(grid).access(40, 40));
+  CATCH_REQUIRE(5 == static_cast<const grid_type&>(copy).access(0, 0));
+  CATCH_REQUIRE(elt_value(41, 40) + 5 ==
+                static_cast<const grid_type&>(copy).access(41, 40));
+}
+
+CATCH_TEST_CASE("view-test", "[tiled_grid]") {
+  grid_type grid(kXDIM, kYDIM, elt_init);
+  const grid_type& cgrid = grid;
+  grid.access(5, 5) = -1;
+  const int& view = cgrid.access(5, 5);
+
+  /* writing through a copy leaves a view of the original as it was */
+  grid_type copy1(grid);
+  copy1.access(5, 5) = -2;
+  CATCH_REQUIRE(-1 == view);
+  CATCH_REQUIRE(&view == &cgrid.access(5, 5));
+
+  /* the original owns its tile again, and is written to in place */
+  grid.access(5, 5) = -3;
+  CATCH_REQUIRE(-3 == view);
+
+  /*
+   * Writing through the original while a copy shares the tile copies it, and
+   * the view is left reading the copy's tile.
+   */
+  grid_type copy2(grid);
+  grid.access(5, 5) = -4;
+  CATCH_REQUIRE(-3 == view);
+  CATCH_REQUIRE(&view != &cgrid.access(5, 5));
+  CATCH_REQUIRE(&view == &static_cast<const grid_type&>(copy2).access(5, 5));
+
+  /* a view of an unallocated element is left reading the blank element */
+  const int& blank = cgrid.access(40, 40);
+  grid.access(40, 40) = -5;
+  CATCH_REQUIRE(elt_value(0, 0) == blank);
+  CATCH_REQUIRE(-5 == cgrid.access(40, 40));
+}
+
+CATCH_TEST_CASE("blank-tiles-test", "[tiled_grid]") {
+  size_t n_inits = 0;
+  grid_type baseline(kXDIM, kYDIM, [&](size_t i, size_t j, int& elt) {
+    ++n_inits;
+    elt_init(i, j, elt);
+  });
+  baseline.blank_tiles_share();
+  size_t n_blank_inits = n_inits;
+  grid_type copy1(baseline);
+  grid_type copy2(baseline);
+
+  /* the first grid to write to a tile initializes the blank tile for it */
+  copy1.access(40, 40) = -1;
+  CATCH_REQUIRE(n_blank_inits + kTILE_DIM * (kYDIM - kTILE_DIM) == n_inits);
+
+  /* the others copy it, and never see what was written to the first's copy */
+  copy2.access(41, 40) = -2;
+  CATCH_REQUIRE(n_blank_inits + kTILE_DIM * (kYDIM - kTILE_DIM) == n_inits);
+  CATCH_REQUIRE(elt_value(40, 40) ==
+                static_cast<const grid_type&>(copy2).access(40, 40));
+  CATCH_REQUIRE(elt_value(41, 41) ==
+                static_cast<const grid_type&>(copy2).access(41, 41));
+  CATCH_REQUIRE(-1 == static_cast<const grid_type&>(copy1).access(40, 40));
+
+  /* the baseline itself allocates nothing until it is written to */
+  CATCH_REQUIRE(0 == baseline.n_allocated_tiles());
+  baseline.access(40, 40) = -3;
+  CATCH_REQUIRE(1 == baseline.n_allocated_tiles());
+  CATCH_REQUIRE(elt_value(40, 40) ==
+                static_cast<const grid_type&>(copy2).access(40, 40));
+}
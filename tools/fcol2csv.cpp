@@ -0,0 +1,132 @@
+/**
+ * @file fcol2csv.cpp
+ *
+ * @brief Convert a binary columnar metrics file (see \ref columnar_writer) to
+ * CSV, in the same format as the CSV output of the metrics collectors.
+ *
+ * Usage: fcol2csv <input.fcol> [separator] > output.csv
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "fordyca/metrics/columnar_writer.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace metrics = fordyca::metrics;
+
+/*******************************************************************************
+ * Free Functions
+ ******************************************************************************/
+template <typename T>
+static bool raw_read(std::ifstream& in, T* value) {
+  return static_cast<bool>(
+      in.read(reinterpret_cast<char*>(value), sizeof(T)));
+} /* raw_read() */
+
+static bool schema_read(std::ifstream& in, metrics::column_schema* schema) {
+  uint64_t magic = 0;
+  uint32_t version = 0;
+  uint32_t n_columns = 0;
+  if (!raw_read(in, &magic) || magic != metrics::columnar_writer::kMAGIC) {
+    std::cerr << "Not a binary columnar metrics file" << std::endl;
+    return false;
+  }
+  if (!raw_read(in, &version) ||
+      version != metrics::columnar_writer::kVERSION) {
+    std::cerr << "Unsupported file version " << version << std::endl;
+    return false;
+  }
+  if (!raw_read(in, &n_columns)) {
+    return false;
+  }
+  for (uint32_t i = 0; i < n_columns; ++i) {
+    uint8_t type;
+    uint32_t len;
+    if (!raw_read(in, &type) || !raw_read(in, &len)) {
+      return false;
+    }
+    std::string name(len, '\0');
+    if (!in.read(&name[0], len)) {
+      return false;
+    }
+    schema->push_back({name, static_cast<metrics::column_type>(type)});
+  } /* for(i..) */
+  return true;
+} /* schema_read() */
+
+static std::string value_str(metrics::column_type type, uint64_t raw) {
+  if (metrics::column_type::kUINT == type) {
+    return std::to_string(raw);
+  }
+  double value;
+  std::memcpy(&value, &raw, sizeof(value));
+  return std::to_string(value);
+} /* value_str() */
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <input.fcol> [separator]"
+              << std::endl;
+    return 1;
+  }
+  std::string sep = (argc > 2) ? argv[2] : ";";
+  std::ifstream in(argv[1], std::ios::binary);
+  if (!in) {
+    std::cerr << "Unable to open " << argv[1] << std::endl;
+    return 1;
+  }
+
+  metrics::column_schema schema;
+  if (!schema_read(in, &schema)) {
+    return 1;
+  }
+  for (auto& c : schema) {
+    std::cout << c.name << sep;
+  } /* for(&c..) */
+  std::cout << "\n";
+
+  std::vector<std::vector<uint64_t>> columns(schema.size());
+  uint32_t n_rows;
+  while (raw_read(in, &n_rows)) {
+    for (auto& c : columns) {
+      c.resize(n_rows);
+      if (!in.read(reinterpret_cast<char*>(c.data()),
+                   static_cast<std::streamsize>(n_rows * sizeof(uint64_t)))) {
+        std::cerr << "Truncated chunk" << std::endl;
+        return 1;
+      }
+    } /* for(&c..) */
+    for (uint32_t i = 0; i < n_rows; ++i) {
+      for (size_t j = 0; j < schema.size(); ++j) {
+        std::cout << value_str(schema[j].type, columns[j][i]) << sep;
+      } /* for(j..) */
+      std::cout << "\n";
+    } /* for(i..) */
+  } /* while() */
+  return 0;
+} /* main() */
@@ -0,0 +1,476 @@
+/**
+ * @file sweep.cpp
+ *
+ * @brief Run a parameter sweep of ARGoS experiments, as many at once as the
+ * available cores allow.
+ *
+ * The sweep is described by a spec file (see exp/benchmark.sweep), which names
+ * an experiment template and the values of each parameter to sweep over. Every
+ * run gets its own directory under the sweep output root, containing the
+ * experiment file rendered from the template, the simulation output, and the
+ * simulator's console output. The wall time, peak RSS, and exit status of each
+ * run is appended to sweep-results.csv in the output root as it finishes, and
+ * runs that already finished successfully are skipped when a sweep is
+ * restarted, so that interrupted sweeps can be resumed.
+ *
+ * Usage: sweep <spec> [-j cores] [-n]
+ *
+ * -j Override the number of cores to use (default: all).
+ * -n Print the runs that would be started, without starting them.
+ *
+ * @copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <experimental/filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fs = std::experimental::filesystem;
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/**
+ * @brief A parameter, and the values to sweep it over, in the order they
+ * appear in the spec.
+ */
+using axis = std::pair<std::string, std::vector<std::string>>;
+
+struct sweep_section {
+  std::string name;
+  std::vector<axis> axes;
+};
+
+struct sweep_spec {
+  std::string template_fname{};
+  std::string output_root{"sweep"};
+  std::string command{"argos3"};
+  size_t cores{0};
+  size_t cores_per_run{1};
+  std::vector<axis> shared{};
+  std::vector<sweep_section> sections{};
+};
+
+struct sweep_run {
+  std::string name;
+  std::map<std::string, std::string> params;
+};
+
+struct active_run {
+  const sweep_run* run;
+  std::chrono::steady_clock::time_point start;
+};
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static constexpr char kRESULTS_FNAME[] = "sweep-results.csv";
+static constexpr char kEXP_FNAME[] = "exp.argos";
+static constexpr char kLOG_FNAME[] = "console.log";
+static constexpr char kSEP[] = ";";
+
+static volatile sig_atomic_t g_stop = 0;
+
+/*******************************************************************************
+ * Free Functions
+ ******************************************************************************/
+static std::string trim(const std::string& s) {
+  size_t start = s.find_first_not_of(" \t");
+  if (std::string::npos == start) {
+    return "";
+  }
+  return s.substr(start, s.find_last_not_of(" \t") - start + 1);
+} /* trim() */
+
+static std::vector<std::string> split(const std::string& s) {
+  std::istringstream in(s);
+  std::vector<std::string> tokens;
+  std::string token;
+  while (in >> token) {
+    tokens.push_back(token);
+  } /* while() */
+  return tokens;
+} /* split() */
+
+/**
+ * @brief Set the values of a parameter, replacing any previous values.
+ */
+static void axis_set(std::vector<axis>* axes,
+                     const std::string& key,
+                     const std::vector<std::string>& values) {
+  auto it = std::find_if(axes->begin(), axes->end(), [&](const axis& a) {
+    return a.first == key;
+  });
+  if (it != axes->end()) {
+    it->second = values;
+  } else {
+    axes->emplace_back(key, values);
+  }
+} /* axis_set() */
+
+static bool spec_parse(const std::string& fname, sweep_spec* spec) {
+  std::ifstream in(fname);
+  if (!in) {
+    std::cerr << "Unable to open " << fname << std::endl;
+    return false;
+  }
+  std::string line;
+  size_t lineno = 0;
+  while (std::getline(in, line)) {
+    ++lineno;
+    line = trim(line.substr(0, line.find('#')));
+    if (line.empty()) {
+      continue;
+    }
+    if ('[' == line.front() && ']' == line.back()) {
+      spec->sections.push_back({trim(line.substr(1, line.size() - 2)), {}});
+      continue;
+    }
+    size_t eq = line.find('=');
+    if (std::string::npos == eq) {
+      std::cerr << fname << ":" << lineno << ": Expected key = value(s)"
+                << std::endl;
+      return false;
+    }
+    std::string key = trim(line.substr(0, eq));
+    std::string value = trim(line.substr(eq + 1));
+    std::vector<std::string> values = split(value);
+    if (key.empty() || values.empty()) {
+      std::cerr << fname << ":" << lineno << ": Empty key or value"
+                << std::endl;
+      return false;
+    }
+
+    if (!spec->sections.empty()) {
+      axis_set(&spec->sections.back().axes, key, values);
+    } else if ("template" == key) {
+      spec->template_fname = value;
+    } else if ("output" == key) {
+      spec->output_root = value;
+    } else if ("command" == key) {
+      spec->command = value;
+    } else if ("cores" == key) {
+      spec->cores = std::stoul(value);
+    } else if ("cores_per_run" == key) {
+      spec->cores_per_run = std::max(1UL, std::stoul(value));
+    } else {
+      axis_set(&spec->shared, key, values);
+    }
+  } /* while() */
+
+  if (spec->template_fname.empty()) {
+    std::cerr << fname << ": No experiment template specified" << std::endl;
+    return false;
+  }
+  if (spec->sections.empty()) {
+    spec->sections.push_back({"sweep", {}});
+  }
+  return true;
+} /* spec_parse() */
+
+/**
+ * @brief Expand each section of the spec into the cross product of the values
+ * of its parameters (and the shared parameters it does not override). Earlier
+ * parameters vary slowest. Runs are named by their section and the values of
+ * the parameters that vary within it, so names are stable across invocations
+ * as long as the spec is not changed.
+ */
+static std::vector<sweep_run> spec_expand(const sweep_spec& spec) {
+  std::vector<sweep_run> runs;
+  for (auto& section : spec.sections) {
+    std::vector<axis> axes = spec.shared;
+    for (auto& a : section.axes) {
+      axis_set(&axes, a.first, a.second);
+    } /* for(&a..) */
+
+    std::vector<size_t> index(axes.size(), 0);
+    while (true) {
+      sweep_run run{section.name, {}};
+      std::string sep = "-";
+      for (size_t i = 0; i < axes.size(); ++i) {
+        const std::string& value = axes[i].second[index[i]];
+        run.params[axes[i].first] = value;
+        if (axes[i].second.size() > 1) {
+          run.name += sep + axes[i].first + "=" + value;
+          sep = ",";
+        }
+      } /* for(i..) */
+      runs.push_back(run);
+
+      /* advance the last parameter fastest, odometer style */
+      size_t i = axes.size();
+      while (i > 0 && ++index[i - 1] == axes[i - 1].second.size()) {
+        index[i - 1] = 0;
+        --i;
+      } /* while() */
+      if (0 == i) {
+        break;
+      }
+    } /* while() */
+  }   /* for(&section..) */
+  return runs;
+} /* spec_expand() */
+
+/**
+ * @brief Substitute every \c \@name\@ in the template with the value of the
+ * named parameter. All placeholders must have a value.
+ */
+static bool render(const std::string& tmpl,
+                   const std::map<std::string, std::string>& params,
+                   std::string* out) {
+  static const std::regex kPLACEHOLDER("@([A-Za-z_][A-Za-z0-9_]*)@");
+  out->clear();
+  auto last = tmpl.cbegin();
+  for (std::sregex_iterator it(tmpl.cbegin(), tmpl.cend(), kPLACEHOLDER), end;
+       it != end;
+       ++it) {
+    auto value = params.find((*it)[1].str());
+    if (value == params.end()) {
+      std::cerr << "No value for template parameter " << (*it)[1].str()
+                << std::endl;
+      return false;
+    }
+    out->append(last, (*it)[0].first);
+    out->append(value->second);
+    last = (*it)[0].second;
+  } /* for(it..) */
+  out->append(last, tmpl.cend());
+  return true;
+} /* render() */
+
+/**
+ * @brief Get the names of the runs that have already finished successfully.
+ */
+static std::set<std::string> results_read(const fs::path& fname) {
+  std::set<std::string> done;
+  std::ifstream in(fname.string());
+  std::string line;
+  std::getline(in, line); /* header */
+  while (std::getline(in, line)) {
+    std::vector<std::string> fields;
+    size_t start = 0;
+    size_t end;
+    while (std::string::npos != (end = line.find(kSEP, start))) {
+      fields.push_back(line.substr(start, end - start));
+      start = end + 1;
+    } /* while() */
+    if (fields.size() >= 2 && "0" == fields[1]) {
+      done.insert(fields[0]);
+    }
+  } /* while() */
+  return done;
+} /* results_read() */
+
+static void stop_handler(int) { g_stop = 1; }
+
+/**
+ * @brief Start a run in its own process, with its console output going to its
+ * directory. OpenMP in the simulation is limited to the per-run core budget.
+ */
+static pid_t run_start(const sweep_spec& spec,
+                       const fs::path& run_dir,
+                       size_t cores) {
+  std::vector<std::string> args = split(spec.command);
+  args.push_back("-c");
+  args.push_back((run_dir / kEXP_FNAME).string());
+
+  pid_t pid = fork();
+  if (0 != pid) {
+    return pid;
+  }
+  int fd = open((run_dir / kLOG_FNAME).c_str(),
+                O_WRONLY | O_CREAT | O_TRUNC,
+                0644);
+  if (-1 != fd) {
+    dup2(fd, STDOUT_FILENO);
+    dup2(fd, STDERR_FILENO);
+    close(fd);
+  }
+  setenv("OMP_NUM_THREADS", std::to_string(cores).c_str(), 1);
+
+  std::vector<char*> argv;
+  for (auto& a : args) {
+    argv.push_back(&a[0]);
+  } /* for(&a..) */
+  argv.push_back(nullptr);
+  execvp(argv[0], argv.data());
+  std::perror(argv[0]);
+  _exit(127);
+} /* run_start() */
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <spec> [-j cores] [-n]"
+              << std::endl;
+    return 1;
+  }
+  sweep_spec spec;
+  if (!spec_parse(argv[1], &spec)) {
+    return 1;
+  }
+  bool dry_run = false;
+  for (int i = 2; i < argc; ++i) {
+    if (0 == std::strcmp(argv[i], "-n")) {
+      dry_run = true;
+    } else if (0 == std::strcmp(argv[i], "-j") && i + 1 < argc) {
+      spec.cores = std::stoul(argv[++i]);
+    } else {
+      std::cerr << "Unknown option " << argv[i] << std::endl;
+      return 1;
+    }
+  } /* for(i..) */
+  if (0 == spec.cores) {
+    spec.cores = std::max(1U, std::thread::hardware_concurrency());
+  }
+  size_t slots = std::max(1UL, spec.cores / spec.cores_per_run);
+
+  std::ifstream tmpl_in(spec.template_fname);
+  if (!tmpl_in) {
+    std::cerr << "Unable to open " << spec.template_fname << std::endl;
+    return 1;
+  }
+  std::string tmpl((std::istreambuf_iterator<char>(tmpl_in)),
+                   std::istreambuf_iterator<char>());
+
+  fs::path root = fs::absolute(spec.output_root);
+  fs::path results_fname = root / kRESULTS_FNAME;
+  std::set<std::string> done = results_read(results_fname);
+  std::vector<sweep_run> runs;
+  for (auto& run : spec_expand(spec)) {
+    if (done.end() == done.find(run.name)) {
+      runs.push_back(run);
+    }
+  } /* for(&run..) */
+  std::cout << runs.size() << " runs to go (" << done.size()
+            << " already finished), " << slots << " at a time" << std::endl;
+  if (dry_run) {
+    for (auto& run : runs) {
+      std::cout << run.name << std::endl;
+    } /* for(&run..) */
+    return 0;
+  }
+
+  /* render everything up front, so a bad template fails before any runs */
+  fs::create_directories(root);
+  for (auto& run : runs) {
+    fs::path run_dir = root / run.name;
+    fs::create_directories(run_dir);
+    auto params = run.params;
+    params["output_root"] = run_dir.string();
+    params["run"] = run.name;
+    std::string exp;
+    if (!render(tmpl, params, &exp)) {
+      return 1;
+    }
+    std::ofstream((run_dir / kEXP_FNAME).string()) << exp;
+  } /* for(&run..) */
+
+  bool new_results = !fs::exists(results_fname);
+  std::ofstream results(results_fname.string(), std::ios::app);
+  if (new_results) {
+    results << "run" << kSEP << "status" << kSEP << "wall_time_s" << kSEP
+            << "peak_rss_kb" << kSEP << std::endl;
+  }
+
+  /*
+   * Stop starting new runs on SIGINT/SIGTERM, but wait for the ones in flight
+   * (which will usually have been interrupted too), so that they are recorded
+   * as failed and re-run on resume.
+   */
+  struct sigaction sa;
+  std::memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = stop_handler;
+  sigaction(SIGINT, &sa, nullptr);
+  sigaction(SIGTERM, &sa, nullptr);
+
+  std::map<pid_t, active_run> active;
+  size_t next = 0;
+  size_t n_failed = 0;
+  while (true) {
+    while (!g_stop && active.size() < slots && next < runs.size()) {
+      const sweep_run& run = runs[next++];
+      pid_t pid = run_start(spec, root / run.name, spec.cores_per_run);
+      if (-1 == pid) {
+        std::perror("fork");
+        g_stop = 1;
+        break;
+      }
+      active[pid] = {&run, std::chrono::steady_clock::now()};
+      std::cout << "Started " << run.name << std::endl;
+    } /* while() */
+    if (active.empty()) {
+      break;
+    }
+
+    int status;
+    struct rusage usage;
+    pid_t pid = wait4(-1, &status, 0, &usage);
+    if (-1 == pid) {
+      if (EINTR == errno) {
+        continue;
+      }
+      std::perror("wait4");
+      return 1;
+    }
+    auto it = active.find(pid);
+    if (it == active.end()) {
+      continue;
+    }
+    double wall = std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - it->second.start)
+                      .count();
+    /* killed by a signal is reported as -signal */
+    int code = WIFEXITED(status) ? WEXITSTATUS(status) : -WTERMSIG(status);
+    n_failed += (0 != code);
+    results << it->second.run->name << kSEP << code << kSEP << wall << kSEP
+            << usage.ru_maxrss << kSEP << std::endl;
+    std::cout << "Finished " << it->second.run->name << ": status=" << code
+              << ", wall_time=" << wall << "s, peak_rss=" << usage.ru_maxrss
+              << "kB" << std::endl;
+    active.erase(it);
+  } /* while() */
+
+  if (next < runs.size()) {
+    std::cout << "Stopped with " << runs.size() - next
+              << " runs not started; re-run to resume" << std::endl;
+  }
+  return (0 == n_failed && next == runs.size()) ? 0 : 1;
+} /* main() */